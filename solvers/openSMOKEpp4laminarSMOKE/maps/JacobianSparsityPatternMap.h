@@ -117,6 +117,18 @@ namespace OpenSMOKE
 
 	private:
 
+		/**
+		*@brief Adds the contribution of column k of a matrix of derivatives of reaction rates
+		*       to the current column of the Jacobian matrix (i.e. S^T * dr/domega)
+		*/
+		void AddColumnToJacobian(const Eigen::SparseMatrix<double>& dr_over_domega, const int k, const double sign);
+
+		/**
+		*@brief Resets the elements of the current column of the Jacobian matrix touched by AddColumnToJacobian
+		*/
+		void ResetJacobianColumn(const Eigen::SparseMatrix<double>& dr_over_domega, const int k);
+
+
 		map& kinetics_map_;	//!< reference to the kinetic map 
 
 		Eigen::SparseMatrix<double>* drf_over_domega_;
@@ -124,6 +136,7 @@ namespace OpenSMOKE
 		Eigen::SparseMatrix<double>* dthirdbody_over_domega_;
 		Eigen::SparseMatrix<double>* dfalloff_over_domega_;
 		Eigen::SparseMatrix<double>* dcabr_over_domega_;
+		Eigen::SparseMatrix<double>* stoichiometric_shadow_;	//!< stoichiometric matrix (species x reactions)
 		Eigen::SparseMatrix<double>* jacobian_matrix_;
 
 		Eigen::VectorXi analytical_thirdbody_reactions_;
@@ -136,6 +149,7 @@ namespace OpenSMOKE
 		Eigen::VectorXd analytical_RStar_;
 		Eigen::VectorXd analytical_rf_;
 		Eigen::VectorXd analytical_rb_;
+		Eigen::VectorXd analytical_Jcolumn_;
 
 		unsigned int nr;
 		unsigned int nc;
@@ -66,6 +66,9 @@ namespace OpenSMOKE
 		analytical_rb_.resize(nr);
 		analytical_rb_.setZero();
 
+		analytical_Jcolumn_.resize(nc);
+		analytical_Jcolumn_.setZero();
+
 		// Reactants
 		{
 			typedef Eigen::Triplet<double> list_of_values;
@@ -211,7 +214,6 @@ namespace OpenSMOKE
 		}
 
 		// Stoichiometric map
-		Eigen::SparseMatrix<double>* stoichiometric_shadow;
 		{
 			typedef Eigen::Triplet<double> list_of_values;
 			std::vector<list_of_values> tripletList;
@@ -236,17 +238,15 @@ namespace OpenSMOKE
 			}
 
 
-			stoichiometric_shadow = new Eigen::SparseMatrix<double>(nc, nr);
-			stoichiometric_shadow->setFromTriplets(tripletList.begin(), tripletList.end());
+			stoichiometric_shadow_ = new Eigen::SparseMatrix<double>(nc, nr);
+			stoichiometric_shadow_->setFromTriplets(tripletList.begin(), tripletList.end());
 		}
 
 		// Jacobian matrix (pattern)
 		{
 			jacobian_matrix_ = new Eigen::SparseMatrix<double>(nc, nc);
-			*jacobian_matrix_ = (*stoichiometric_shadow) * (*drf_over_domega_ - *drb_over_domega_ + *dthirdbody_over_domega_ + *dfalloff_over_domega_ + *dcabr_over_domega_);
+			*jacobian_matrix_ = (*stoichiometric_shadow_) * (*drf_over_domega_ - *drb_over_domega_ + *dthirdbody_over_domega_ + *dfalloff_over_domega_ + *dcabr_over_domega_);
 		}
-
-			delete stoichiometric_shadow;
 	}
 
 	template<typename map>
@@ -257,6 +257,7 @@ namespace OpenSMOKE
 		delete dthirdbody_over_domega_;
 		delete dfalloff_over_domega_;
 		delete dcabr_over_domega_;
+		delete stoichiometric_shadow_;
 		delete jacobian_matrix_;		
 	}
 
@@ -398,31 +399,49 @@ namespace OpenSMOKE
 			}
 		}
 
-		// Jacobian matrix (version 2)
+		// Jacobian matrix (version 3): J = S^T * (drf - drb + dthirdbody + dfalloff + dcabr)
+		// Each column is assembled by scattering only the non-zero elements, so that
+		// the cost scales with the number of non-zero elements and not with nc*nr
 		{
 			for (int k = 0; k < J.outerSize(); ++k)
 			{
-				std::fill(kinetics_map_.NetReactionRates().begin(), kinetics_map_.NetReactionRates().end(), 0.);
-				for (Eigen::SparseMatrix<double>::InnerIterator it(*drf_over_domega_, k); it; ++it)
-					kinetics_map_.NetReactionRates()[it.row()] = it.value();
-				for (Eigen::SparseMatrix<double>::InnerIterator it(*drb_over_domega_, k); it; ++it)
-					kinetics_map_.NetReactionRates()[it.row()] -= it.value();
-
-				for (Eigen::SparseMatrix<double>::InnerIterator it(*dthirdbody_over_domega_, k); it; ++it)
-					kinetics_map_.NetReactionRates()[it.row()] += it.value();
-				for (Eigen::SparseMatrix<double>::InnerIterator it(*dfalloff_over_domega_, k); it; ++it)
-					kinetics_map_.NetReactionRates()[it.row()] += it.value();
-				for (Eigen::SparseMatrix<double>::InnerIterator it(*dcabr_over_domega_, k); it; ++it)
-					kinetics_map_.NetReactionRates()[it.row()] += it.value();
-
-				kinetics_map_.FormationRates(analytical_RStar_.data());
+				AddColumnToJacobian(*drf_over_domega_, k, 1.);
+				AddColumnToJacobian(*drb_over_domega_, k, -1.);
+				AddColumnToJacobian(*dthirdbody_over_domega_, k, 1.);
+				AddColumnToJacobian(*dfalloff_over_domega_, k, 1.);
+				AddColumnToJacobian(*dcabr_over_domega_, k, 1.);
 
 				for (Eigen::SparseMatrix<double>::InnerIterator it(J, k); it; ++it)
-					it.valueRef() = analytical_RStar_[it.row()];// *thermodynamics_.MW(index-1) / rhoStar;
+					it.valueRef() = analytical_Jcolumn_(it.row());
+
+				ResetJacobianColumn(*drf_over_domega_, k);
+				ResetJacobianColumn(*drb_over_domega_, k);
+				ResetJacobianColumn(*dthirdbody_over_domega_, k);
+				ResetJacobianColumn(*dfalloff_over_domega_, k);
+				ResetJacobianColumn(*dcabr_over_domega_, k);
 			}
 		}
 	}
 
+	template<typename map>
+	void JacobianSparsityPatternMap<map>::AddColumnToJacobian(const Eigen::SparseMatrix<double>& dr_over_domega, const int k, const double sign)
+	{
+		for (Eigen::SparseMatrix<double>::InnerIterator it(dr_over_domega, k); it; ++it)
+		{
+			const double dr = sign*it.value();
+			for (Eigen::SparseMatrix<double>::InnerIterator its(*stoichiometric_shadow_, it.row()); its; ++its)
+				analytical_Jcolumn_(its.row()) += its.value()*dr;
+		}
+	}
+
+	template<typename map>
+	void JacobianSparsityPatternMap<map>::ResetJacobianColumn(const Eigen::SparseMatrix<double>& dr_over_domega, const int k)
+	{
+		for (Eigen::SparseMatrix<double>::InnerIterator it(dr_over_domega, k); it; ++it)
+			for (Eigen::SparseMatrix<double>::InnerIterator its(*stoichiometric_shadow_, it.row()); its; ++its)
+				analytical_Jcolumn_(its.row()) = 0.;
+	}
+
 	template<typename map>
 	void JacobianSparsityPatternMap<map>::Jacobian(const double* omega, const double T, const double P_Pa, Eigen::VectorXd &Jdiagonal)
 	{
@@ -206,6 +206,48 @@ namespace OpenSMOKE
 		*/
 		void ReactionRates(const double* c, const double cTot);
 
+	public:	// Batched evaluation (structure-of-arrays layout: the point index is the innermost, i.e. v[j*nPoints+k])
+
+		/**
+		*@brief Calculates the kinetic constants for a batch of points (e.g. cells). The thermodynamic map
+		*       is left at the state of the last point, while the state of the current kinetic map is not modified
+		*@param T temperatures of points (in K)
+		*@param P pressures of points (in Pa)
+		*@param nPoints number of points
+		*/
+		void KineticConstantsBatch(const double* T, const double* P, const unsigned int nPoints);
+
+		/**
+		*@brief Calculates the reaction rates for the batch of points defined by the last call to KineticConstantsBatch
+		*@param c concentrations of species (in kmol/m3), nSpecies x nPoints
+		*/
+		void ReactionRatesBatch(const double* c);
+
+		/**
+		*@brief Calculates the formation rates (in kmol/m3/s) for the current batch of points
+		*@param R formation rates of species, nSpecies x nPoints
+		*/
+		void FormationRatesBatch(double* R);
+
+		/**
+		*@brief Calculates the heat release (in J/m3/s) for the current batch of points
+		*@param R formation rates of species (in kmol/m3/s), nSpecies x nPoints
+		*@param Q heat release of points
+		*/
+		void HeatReleaseBatch(const double* R, double* Q);
+
+		/**
+		*@brief Returns the net reaction rates (in kmol/m3/s) for the current batch of points, nReactions x nPoints
+		*/
+		const std::vector<double>& NetReactionRatesBatch() const { return netReactionRates_batch__; }
+
+		/**
+		*@brief Returns the number of points of the current batch
+		*/
+		unsigned int NumberOfBatchPoints() const { return number_of_batch_points_; }
+
+	public:
+
 		/**
 		*@brief Returns the indices of the reversible reactions
 		*/
@@ -448,6 +490,11 @@ namespace OpenSMOKE
 		*/
 		void ExtendedFallOffReactions(const double cTot, const double* c);
 
+		/**
+		*@brief Calculates the Arrhenius kinetic constants for the current batch of points
+		*/
+		void ArrheniusBatch(const std::vector<double>& lnA, const std::vector<double>& Beta, const std::vector<double>& E_over_R, std::vector<double>& k);
+
 		/**
 		*@brief Copies the data from another kinetic map (used by copy constructors)
 		*/
@@ -597,6 +644,30 @@ namespace OpenSMOKE
 		std::vector<unsigned int> local_family_index__;
 
 		JacobianSparsityPatternMap<KineticsMap_CHEMKIN>* jacobian_sparsity_pattern_map_;
+
+		// Batched evaluation (structure-of-arrays)
+		unsigned int number_of_batch_points_;				//!< number of points of the current batch
+		std::vector<double> T_batch__;					//!< temperatures of points
+		std::vector<double> P_batch__;					//!< pressures of points
+		std::vector<double> logT_batch__;				//!< logarithm of temperatures
+		std::vector<double> uT_batch__;					//!< reciprocal of temperatures
+		std::vector<double> log_Patm_over_RT_batch__;			//!< logarithm of Patm/RT
+		std::vector<double> cTot_batch__;				//!< total concentrations
+		std::vector<double> M_batch__;					//!< third-body concentrations
+		std::vector<double> species_h_over_RT_batch__;			//!< species enthalpies (normalized)
+		std::vector<double> species_g_over_RT_batch__;			//!< species Gibbs free energies (normalized)
+		std::vector<double> reaction_g_over_RT_batch__;			//!< reaction Gibbs free energies (normalized)
+		std::vector<double> kArrhenius_batch__;
+		std::vector<double> kArrheniusModified_batch__;
+		std::vector<double> uKeq_batch__;
+		std::vector<double> kArrhenius_reversible_batch__;
+		std::vector<double> kArrhenius_falloff_inf_batch__;
+		std::vector<double> kArrhenius_cabr_inf_batch__;
+		std::vector<double> logFcent_falloff_batch__;
+		std::vector<double> logFcent_cabr_batch__;
+		std::vector<double> forwardReactionRates_batch__;
+		std::vector<double> reverseReactionRates_batch__;
+		std::vector<double> netReactionRates_batch__;
 	};
 
 }
@@ -46,6 +46,7 @@ namespace OpenSMOKE
 		this->number_of_points_ = nPoints;
         this->verbose_output_ = true;
         this->isJacobianSparsityMapAvailable_ = false;
+        this->number_of_batch_points_ = 0;
                 
 		this->T_ = this->P_ = 0.;
 	}
@@ -57,6 +58,7 @@ namespace OpenSMOKE
                 
         this->verbose_output_ = true;
         this->isJacobianSparsityMapAvailable_ = false;
+        this->number_of_batch_points_ = 0;
                 
 		ImportSpeciesFromXMLFile(doc);
 		ImportCoefficientsFromXMLFile(doc);
@@ -70,6 +72,7 @@ namespace OpenSMOKE
                 
         this->verbose_output_ = verbose;
         this->isJacobianSparsityMapAvailable_ = false;
+        this->number_of_batch_points_ = 0;
                 
 		ImportSpeciesFromXMLFile(doc);
 		ImportCoefficientsFromXMLFile(doc);
@@ -194,6 +197,7 @@ namespace OpenSMOKE
         this->nonconventional_kinetic_constants_must_be_recalculated_ = true;
         this->reaction_h_and_s_must_be_recalculated_ = true;
         this->isJacobianSparsityMapAvailable_ = false;
+        this->number_of_batch_points_ = 0;
 
 		reaction_s_over_R__.resize(rhs.reaction_s_over_R__.size());
 		reaction_h_over_RT__.resize(rhs.reaction_h_over_RT__.size());
@@ -3327,5 +3331,459 @@ namespace OpenSMOKE
 		dF_over_dA0 = Pr/std::exp(lnA__[j-1]) * dF_over_dPr;
 		dF_over_dAInf = -Pr/std::exp(lnA_falloff_inf__[k-1]) * dF_over_dPr;
 	}
+
+	void KineticsMap_CHEMKIN::ArrheniusBatch(const std::vector<double>& lnA, const std::vector<double>& Beta, const std::vector<double>& E_over_R, std::vector<double>& k)
+	{
+		const unsigned int n = number_of_batch_points_;
+		const double* logT = logT_batch__.data();
+		const double* uT = uT_batch__.data();
+
+		for (unsigned int j = 0; j < lnA.size(); j++)
+		{
+			double* kj = k.data() + j*n;
+			const double lnAj = lnA[j];
+			const double Betaj = Beta[j];
+			const double E_over_Rj = E_over_R[j];
+
+			for (unsigned int p = 0; p < n; p++)
+				kj[p] = lnAj + Betaj*logT[p] - E_over_Rj*uT[p];
+		}
+
+		Exp(k, &k);
+	}
+
+	void KineticsMap_CHEMKIN::KineticConstantsBatch(const double* T, const double* P, const unsigned int nPoints)
+	{
+		const unsigned int n = nPoints;
+		const unsigned int NR = this->number_of_reactions_;
+		const unsigned int NS = this->number_of_species_;
+
+		// Memory allocation (only if the number of points changes)
+		if (number_of_batch_points_ != n)
+		{
+			number_of_batch_points_ = n;
+
+			T_batch__.resize(n);
+			P_batch__.resize(n);
+			logT_batch__.resize(n);
+			uT_batch__.resize(n);
+			log_Patm_over_RT_batch__.resize(n);
+			cTot_batch__.resize(n);
+			M_batch__.resize(n);
+
+			species_h_over_RT_batch__.resize(NS*n);
+			species_g_over_RT_batch__.resize(NS*n);
+			reaction_g_over_RT_batch__.resize(NR*n);
+
+			kArrhenius_batch__.resize(NR*n);
+			kArrheniusModified_batch__.resize(NR*n);
+			uKeq_batch__.resize(number_of_thermodynamic_reversible_reactions_*n);
+			kArrhenius_reversible_batch__.resize(number_of_explicitly_reversible_reactions_*n);
+			kArrhenius_falloff_inf_batch__.resize(number_of_falloff_reactions_*n);
+			kArrhenius_cabr_inf_batch__.resize(number_of_cabr_reactions_*n);
+			logFcent_falloff_batch__.resize(number_of_falloff_reactions_*n);
+			logFcent_cabr_batch__.resize(number_of_cabr_reactions_*n);
+
+			forwardReactionRates_batch__.resize(NR*n);
+			reverseReactionRates_batch__.resize(NR*n);
+			netReactionRates_batch__.resize(NR*n);
+		}
+
+		// Temperature dependent quantities
+		for (unsigned int p = 0; p < n; p++)
+		{
+			T_batch__[p] = T[p];
+			P_batch__[p] = P[p];
+			logT_batch__[p] = std::log(T[p]);
+			uT_batch__[p] = 1./T[p];
+			log_Patm_over_RT_batch__[p] = std::log(101325./PhysicalConstants::R_J_kmol/T[p]);
+		}
+
+		// Species enthalpies and Gibbs free energies (point by point, the cost scales with the number of species only)
+		for (unsigned int p = 0; p < n; p++)
+		{
+			thermodynamics_.SetTemperature(T[p]);
+			thermodynamics_.SetPressure(P[p]);
+			const std::vector<double>& h_over_RT = thermodynamics_.Species_H_over_RT();
+			const std::vector<double>& s_over_R = thermodynamics_.Species_S_over_R();
+
+			for (unsigned int i = 0; i < NS; i++)
+			{
+				species_h_over_RT_batch__[i*n+p] = h_over_RT[i];
+				species_g_over_RT_batch__[i*n+p] = h_over_RT[i] - s_over_R[i];
+			}
+		}
+
+		// Forward kinetic constants (Arrhenius' Law)
+		{
+			ArrheniusBatch(lnA__, Beta__, E_over_R__, kArrhenius_batch__);
+
+			// Negative frequency factors: reactions must be reversed
+			for (unsigned int j = 0; j < negative_lnA__.size(); j++)
+			{
+				double* kj = kArrhenius_batch__.data() + (negative_lnA__[j]-1)*n;
+				for (unsigned int p = 0; p < n; p++)
+					kj[p] *= -1.;
+			}
+		}
+
+		// Equilibrium constants (inverse value)
+		if (number_of_thermodynamic_reversible_reactions_ != 0)
+		{
+			stoichiometry_->ReactionChangeOfPropertyBatch(reaction_g_over_RT_batch__.data(), species_g_over_RT_batch__.data(), n);
+
+			for (unsigned int k = 0; k < number_of_thermodynamic_reversible_reactions_; k++)
+			{
+				const unsigned int j = indices_of_thermodynamic_reversible_reactions__[k]-1;
+				const double* dg = reaction_g_over_RT_batch__.data() + j*n;
+				const double dn = changeOfMoles__[j];
+				double* uKeq = uKeq_batch__.data() + k*n;
+
+				for (unsigned int p = 0; p < n; p++)
+					uKeq[p] = dg[p] - log_Patm_over_RT_batch__[p]*dn;
+			}
+
+			Exp(uKeq_batch__, &uKeq_batch__);
+		}
+
+		// Explicit reverse Arrhenius constants
+		if (number_of_explicitly_reversible_reactions_ != 0)
+			ArrheniusBatch(lnA_reversible__, Beta_reversible__, E_over_R_reversible__, kArrhenius_reversible_batch__);
+
+		// Fall-off high temperature region kinetic constants
+		if (number_of_falloff_reactions_ != 0)
+		{
+			ArrheniusBatch(lnA_falloff_inf__, Beta_falloff_inf__, E_over_R_falloff_inf__, kArrhenius_falloff_inf_batch__);
+
+			for (unsigned int k = 0; k < number_of_falloff_reactions_; k++)
+			{
+				double* logFcent = logFcent_falloff_batch__.data() + k*n;
+
+				switch (falloff_reaction_type__[k])
+				{
+					case PhysicalConstants::REACTION_TROE_FALLOFF:
+
+						for (unsigned int p = 0; p < n; p++)
+						{
+							logFcent[p] = (1.-a_falloff__[k])*std::exp(-T[p]/b_falloff__[k]) + a_falloff__[k]*std::exp(-T[p]/c_falloff__[k]);
+							if (d_falloff__[k] != 0.)
+								logFcent[p] += std::exp(-d_falloff__[k]/T[p]);
+
+							if (logFcent[p] < 1.e-300)	logFcent[p] = -300.;
+							else				logFcent[p] = std::log10(logFcent[p]);
+						}
+
+						break;
+
+					case PhysicalConstants::REACTION_SRI_FALLOFF:
+
+						for (unsigned int p = 0; p < n; p++)
+							logFcent[p] = a_falloff__[k]*std::exp(-b_falloff__[k]/T[p]) + std::exp(-T[p]/c_falloff__[k]);
+
+						break;
+				}
+			}
+		}
+
+		// Cabr high temperature region kinetic constants
+		if (number_of_cabr_reactions_ != 0)
+		{
+			ArrheniusBatch(lnA_cabr_inf__, Beta_cabr_inf__, E_over_R_cabr_inf__, kArrhenius_cabr_inf_batch__);
+
+			for (unsigned int k = 0; k < number_of_cabr_reactions_; k++)
+			{
+				double* logFcent = logFcent_cabr_batch__.data() + k*n;
+
+				switch (cabr_reaction_type__[k])
+				{
+					case PhysicalConstants::REACTION_TROE_CABR:
+
+						for (unsigned int p = 0; p < n; p++)
+						{
+							logFcent[p] = (1.-a_cabr__[k])*std::exp(-T[p]/b_cabr__[k]) + a_cabr__[k]*std::exp(-T[p]/c_cabr__[k]);
+							if (d_cabr__[k] != 0.)
+								logFcent[p] += std::exp(-d_cabr__[k]/T[p]);
+
+							if (logFcent[p] < 1.e-300)	logFcent[p] = -300.;
+							else				logFcent[p] = std::log10(logFcent[p]);
+						}
+
+						break;
+
+					case PhysicalConstants::REACTION_SRI_CABR:
+
+						for (unsigned int p = 0; p < n; p++)
+							logFcent[p] = a_cabr__[k]*std::exp(-b_cabr__[k]/T[p]) + std::exp(-T[p]/c_cabr__[k]);
+
+						break;
+				}
+			}
+		}
+
+		// Chebishev-Polynomials reactions (point by point)
+		for (unsigned int k = 0; k < number_of_chebyshev_reactions_; k++)
+		{
+			double* kj = kArrhenius_batch__.data() + (indices_of_chebyshev_reactions__[k]-1)*n;
+			for (unsigned int p = 0; p < n; p++)
+				kj[p] = chebyshev_reactions_[k].KineticConstant(T[p], P[p]);
+		}
+
+		// Pressure logarithmic interpolated reactions (point by point)
+		for (unsigned int k = 0; k < number_of_pressurelog_reactions_; k++)
+		{
+			double* kj = kArrhenius_batch__.data() + (indices_of_pressurelog_reactions__[k]-1)*n;
+			for (unsigned int p = 0; p < n; p++)
+				kj[p] = pressurelog_reactions_[k].KineticConstant(T[p], P[p]);
+		}
+	}
+
+	void KineticsMap_CHEMKIN::ReactionRatesBatch(const double* c)
+	{
+		const unsigned int n = number_of_batch_points_;
+		const unsigned int NS = this->number_of_species_;
+
+		// Total concentrations
+		for (unsigned int p = 0; p < n; p++)
+			cTot_batch__[p] = 0.;
+		for (unsigned int i = 0; i < NS; i++)
+			for (unsigned int p = 0; p < n; p++)
+				cTot_batch__[p] += c[i*n+p];
+
+		// Concentrations of a single point (only for reactions evaluated point by point)
+		std::vector<double> cPoint;
+		if (number_of_extendedpressurelog_reactions_ != 0 || number_of_extendedfalloff_reactions_ != 0)
+			cPoint.resize(NS);
+
+		// 1. Extended pressure log reactions (point by point)
+		for (unsigned int k = 0; k < number_of_extendedpressurelog_reactions_; k++)
+		{
+			const unsigned int j = indices_of_extendedpressurelog_reactions__[k]-1;
+			for (unsigned int p = 0; p < n; p++)
+			{
+				for (unsigned int i = 0; i < NS; i++)
+					cPoint[i] = c[i*n+p];
+				kArrhenius_batch__[j*n+p] = extendedpressurelog_reactions_[k].KineticConstant(T_batch__[p], P_batch__[p], cTot_batch__[p], cPoint.data());
+			}
+		}
+
+		kArrheniusModified_batch__ = kArrhenius_batch__;
+
+		// 2. Correct the effective kinetic constants by three-body coefficients
+		for (unsigned int s = 0; s < number_of_thirdbody_reactions_; s++)
+		{
+			double* M = M_batch__.data();
+			for (unsigned int p = 0; p < n; p++)
+				M[p] = cTot_batch__[p];
+			for (unsigned int k = 0; k < indices_of_thirdbody_species__[s].size(); k++)
+			{
+				const double* ck = c + (indices_of_thirdbody_species__[s][k]-1)*n;
+				const double efficiency = indices_of_thirdbody_efficiencies__[s][k];
+				for (unsigned int p = 0; p < n; p++)
+					M[p] += ck[p]*efficiency;
+			}
+
+			double* kj = kArrheniusModified_batch__.data() + (indices_of_thirdbody_reactions__[s]-1)*n;
+			for (unsigned int p = 0; p < n; p++)
+				kj[p] *= M[p];
+		}
+
+		// 3. Correct the effective kinetic constants: Fall-off reactions
+		for (unsigned int k = 0; k < number_of_falloff_reactions_; k++)
+		{
+			double* M = M_batch__.data();
+			if (falloff_index_of_single_thirdbody_species__[k] == 0)
+			{
+				for (unsigned int p = 0; p < n; p++)
+					M[p] = cTot_batch__[p];
+				for (unsigned int s = 0; s < falloff_indices_of_thirdbody_species__[k].size(); s++)
+				{
+					const double* cs = c + (falloff_indices_of_thirdbody_species__[k][s]-1)*n;
+					const double efficiency = falloff_indices_of_thirdbody_efficiencies__[k][s];
+					for (unsigned int p = 0; p < n; p++)
+						M[p] += cs[p]*efficiency;
+				}
+			}
+			else
+			{
+				const double epsilon = 1.e-16;
+				const double* cs = c + (falloff_index_of_single_thirdbody_species__[k]-1)*n;
+				for (unsigned int p = 0; p < n; p++)
+					M[p] = cs[p] + epsilon;
+			}
+
+			const unsigned int j = indices_of_falloff_reactions__[k]-1;
+			const double* k0 = kArrhenius_batch__.data() + j*n;
+			const double* kInf = kArrhenius_falloff_inf_batch__.data() + k*n;
+			const double* logFcent = logFcent_falloff_batch__.data() + k*n;
+			double* kj = kArrheniusModified_batch__.data() + j*n;
+
+			for (unsigned int p = 0; p < n; p++)
+			{
+				const double Pr = k0[p] * M[p] / kInf[p];
+
+				double wF = 1.;
+				switch (falloff_reaction_type__[k])
+				{
+					case PhysicalConstants::REACTION_TROE_FALLOFF:
+
+						if (Pr > 1.e-32)
+						{
+							const double nTroe = 0.75-1.27*logFcent[p];
+							const double cTroe = -0.4-0.67*logFcent[p];
+							const double sTroe = std::log10(Pr) + cTroe;
+							wF = std::pow(10., logFcent[p]/(1. + boost::math::pow<2>(sTroe/(nTroe-0.14*sTroe))));
+						}
+						else
+						{
+							// Asymptotic value for wF when sTroe --> -Inf
+							wF = std::pow(10., logFcent[p]/(1. + boost::math::pow<2>(1./0.14)));
+						}
+
+						break;
+
+					case PhysicalConstants::REACTION_SRI_FALLOFF:
+
+						const double xSRI = 1. / (1. + boost::math::pow<2>(std::log10(Pr)));
+						wF = std::pow(logFcent[p], xSRI) * d_falloff__[k];
+						if (e_falloff__[k] != 0.)
+							wF *= std::pow(T_batch__[p], e_falloff__[k]);
+						break;
+				}
+
+				kj[p] *= kInf[p] * (Pr/(1.+Pr)) * wF / k0[p];
+			}
+		}
+
+		// 4. Extended falloff reactions (point by point)
+		for (unsigned int k = 0; k < number_of_extendedfalloff_reactions_; k++)
+		{
+			const unsigned int j = indices_of_extendedfalloff_reactions__[k]-1;
+			for (unsigned int p = 0; p < n; p++)
+			{
+				for (unsigned int i = 0; i < NS; i++)
+					cPoint[i] = c[i*n+p];
+				kArrhenius_batch__[j*n+p] = extendedfalloff_reactions_[k].KineticConstant(T_batch__[p], P_batch__[p], cTot_batch__[p], cPoint.data());
+				kArrheniusModified_batch__[j*n+p] = kArrhenius_batch__[j*n+p];
+			}
+		}
+
+		// 5. Correct the effective kinetic constants: CABR reactions
+		for (unsigned int k = 0; k < number_of_cabr_reactions_; k++)
+		{
+			double* M = M_batch__.data();
+			if (cabr_index_of_single_thirdbody_species__[k] == 0)
+			{
+				for (unsigned int p = 0; p < n; p++)
+					M[p] = cTot_batch__[p];
+				for (unsigned int s = 0; s < cabr_indices_of_thirdbody_species__[k].size(); s++)
+				{
+					const double* cs = c + (cabr_indices_of_thirdbody_species__[k][s]-1)*n;
+					const double efficiency = cabr_indices_of_thirdbody_efficiencies__[k][s];
+					for (unsigned int p = 0; p < n; p++)
+						M[p] += cs[p]*efficiency;
+				}
+			}
+			else
+			{
+				const double epsilon = 1.e-16;
+				const double* cs = c + (cabr_index_of_single_thirdbody_species__[k]-1)*n;
+				for (unsigned int p = 0; p < n; p++)
+					M[p] = cs[p] + epsilon;
+			}
+
+			const unsigned int j = indices_of_cabr_reactions__[k]-1;
+			const double* k0 = kArrhenius_batch__.data() + j*n;
+			const double* kInf = kArrhenius_cabr_inf_batch__.data() + k*n;
+			const double* logFcent = logFcent_cabr_batch__.data() + k*n;
+			double* kj = kArrheniusModified_batch__.data() + j*n;
+
+			for (unsigned int p = 0; p < n; p++)
+			{
+				const double Pr = k0[p] * M[p] / kInf[p];
+
+				double wF = 1.;
+				double nTroe, cTroe, sTroe, xSRI;
+				switch (cabr_reaction_type__[k])
+				{
+					case PhysicalConstants::REACTION_TROE_CABR:
+
+						nTroe = 0.75-1.27*logFcent[p];
+						cTroe = -0.4-0.67*logFcent[p];
+						sTroe = std::log10(Pr) + cTroe;
+						wF = std::pow(10., logFcent[p]/(1. + boost::math::pow<2>(sTroe/(nTroe-0.14*sTroe))));
+
+						break;
+
+					case PhysicalConstants::REACTION_SRI_CABR:
+
+						xSRI = 1. / (1. + boost::math::pow<2>(std::log10(Pr)));
+						wF = std::pow(logFcent[p], xSRI) * d_cabr__[k];
+						if (e_cabr__[k] != 0.)
+							wF *= std::pow(T_batch__[p], e_cabr__[k]);
+						break;
+				}
+
+				kj[p] *= (1./(1.+Pr)) * wF;
+			}
+		}
+
+		// Product of concentrations (for forward and reverse reactions)
+		stoichiometry_->ProductOfConcentrationsBatch(forwardReactionRates_batch__, reverseReactionRates_batch__, c, n);
+
+		// Corrects the product of concentrations for reverse reaction by the thermodynamic equilibrium constant
+		for (unsigned int k = 0; k < number_of_thermodynamic_reversible_reactions_; k++)
+		{
+			double* rj = reverseReactionRates_batch__.data() + (indices_of_thermodynamic_reversible_reactions__[k]-1)*n;
+			const double* uKeq = uKeq_batch__.data() + k*n;
+			for (unsigned int p = 0; p < n; p++)
+				rj[p] *= uKeq[p];
+		}
+
+		// Corrects the product of concentrations for reverse reaction by the explicit Arrhenius kinetic parameters
+		for (unsigned int k = 0; k < number_of_explicitly_reversible_reactions_; k++)
+		{
+			const unsigned int j = indices_of_explicitly_reversible_reactions__[k]-1;
+			double* rj = reverseReactionRates_batch__.data() + j*n;
+			const double* kReverse = kArrhenius_reversible_batch__.data() + k*n;
+			const double* kForward = kArrhenius_batch__.data() + j*n;
+			for (unsigned int p = 0; p < n; p++)
+				rj[p] *= kReverse[p]/kForward[p];
+		}
+
+		// Net reaction rates [kmol/m3/s]
+		netReactionRates_batch__ = forwardReactionRates_batch__;
+		for (unsigned int k = 0; k < number_of_reversible_reactions_; k++)
+		{
+			const unsigned int j = indices_of_reversible_reactions__[k]-1;
+			double* rj = netReactionRates_batch__.data() + j*n;
+			const double* rb = reverseReactionRates_batch__.data() + j*n;
+			for (unsigned int p = 0; p < n; p++)
+				rj[p] -= rb[p];
+		}
+		for (unsigned int j = 0; j < netReactionRates_batch__.size(); j++)
+			netReactionRates_batch__[j] *= kArrheniusModified_batch__[j];
+	}
+
+	void KineticsMap_CHEMKIN::FormationRatesBatch(double* R)
+	{
+		stoichiometry_->FormationRatesFromReactionRatesBatch(R, netReactionRates_batch__.data(), number_of_batch_points_);
+	}
+
+	void KineticsMap_CHEMKIN::HeatReleaseBatch(const double* R, double* Q)
+	{
+		const unsigned int n = number_of_batch_points_;
+
+		for (unsigned int p = 0; p < n; p++)
+			Q[p] = 0.;
+		for (unsigned int i = 0; i < this->number_of_species_; i++)
+		{
+			const double* Ri = R + i*n;
+			const double* h_over_RT = species_h_over_RT_batch__.data() + i*n;
+			for (unsigned int p = 0; p < n; p++)
+				Q[p] -= Ri[p]*h_over_RT[p];
+		}
+		for (unsigned int p = 0; p < n; p++)
+			Q[p] *= PhysicalConstants::R_J_kmol * T_batch__[p];
+	}
 }
 
@@ -0,0 +1,102 @@
+/*-----------------------------------------------------------------------*\
+|    ___                   ____  __  __  ___  _  _______                  |
+|   / _ \ _ __   ___ _ __ / ___||  \/  |/ _ \| |/ / ____| _     _         |
+|  | | | | '_ \ / _ \ '_ \\___ \| |\/| | | | | ' /|  _| _| |_ _| |_       |
+|  | |_| | |_) |  __/ | | |___) | |  | | |_| | . \| |__|_   _|_   _|      |
+|   \___/| .__/ \___|_| |_|____/|_|  |_|\___/|_|\_\_____||_|   |_|        |
+|        |_|                                                              |
+|                                                                         |
+|   Author: Alberto Cuoci <alberto.cuoci@polimi.it>                       |
+|   CRECK Modeling Group <http://creckmodeling.chem.polimi.it>            |
+|   Department of Chemistry, Materials and Chemical Engineering           |
+|   Politecnico di Milano                                                 |
+|   P.zza Leonardo da Vinci 32, 20133 Milano                              |
+|                                                                         |
+|-------------------------------------------------------------------------|
+|                                                                         |
+|   This file is part of OpenSMOKE++ framework.                           |
+|                                                                         |
+|	License                                                           |
+|                                                                         |
+|   Copyright(C) 2014, 2013, 2012  Alberto Cuoci                          |
+|   OpenSMOKE++ is free software: you can redistribute it and/or modify   |
+|   it under the terms of the GNU General Public License as published by  |
+|   the Free Software Foundation, either version 3 of the License, or     |
+|   (at your option) any later version.                                   |
+|                                                                         |
+|   OpenSMOKE++ is distributed in the hope that it will be useful,        |
+|   but WITHOUT ANY WARRANTY; without even the implied warranty of        |
+|   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         |
+|   GNU General Public License for more details.                          |
+|                                                                         |
+|   You should have received a copy of the GNU General Public License     |
+|   along with OpenSMOKE++. If not, see <http://www.gnu.org/licenses/>.   |
+|                                                                         |
+\*-----------------------------------------------------------------------*/
+
+
+#ifndef OpenSMOKE_MechanismBinaryImage_H
+#define OpenSMOKE_MechanismBinaryImage_H
+
+#include <boost/filesystem.hpp>
+#include <stdint.h>
+
+namespace OpenSMOKE
+{
+	class ThermodynamicsMap_CHEMKIN;
+	class TransportPropertiesMap_CHEMKIN;
+
+	//!  Binary image of the thermodynamic and transport data of a kinetic mechanism
+	/*!
+	The binary image is written by the CHEMKIN preprocessor next to the kinetics.xml file. It stores
+	the coefficients of the thermodynamic and transport maps in native binary format, so that they can
+	be loaded without parsing their text representation (the transport fitting coefficients grow
+	with the square of the number of species and are the bulk of the XML file). The image is accepted
+	only if the version, the binary layout and the checksum of the kinetics.xml file it was generated
+	from are unchanged, and if the size and the checksum of the data stored after the header match 
+	the ones recorded in the header (truncated or partially written images are rejected); otherwise 
+	the maps have to be imported from the XML file.
+	*/
+
+	const char MECHANISM_BINARY_IMAGE_MAGIC[8] = { 'O', 'S', 'M', 'K', 'B', 'I', 'N', '\0' };
+	const uint32_t MECHANISM_BINARY_IMAGE_VERSION = 2;
+	const uint32_t MECHANISM_BINARY_IMAGE_BYTE_ORDER = 0x01020304;
+
+	/**
+	*@brief Returns the checksum (64-bit FNV-1a) of a file
+	*@param file_name name of the file
+	*/
+	uint64_t MechanismBinaryImageChecksum(const boost::filesystem::path& file_name);
+
+	/**
+	*@brief Returns the checksum (64-bit FNV-1a) of the remaining content of a stream
+	*@param fInput the stream (read until the end)
+	*@param size number of bytes read
+	*/
+	uint64_t MechanismBinaryImageChecksum(std::istream& fInput, uint64_t& size);
+
+	/**
+	*@brief Writes the binary image of the thermodynamic and (optionally) transport data
+	*@param file_image name of the binary image to be written
+	*@param file_xml name of the kinetics.xml file from which the maps were imported
+	*@param thermodynamicsMap thermodynamic map
+	*@param transportMap transport map (nullptr if transport data are not available)
+	*/
+	void WriteMechanismBinaryImage(	const boost::filesystem::path& file_image, const boost::filesystem::path& file_xml,
+					ThermodynamicsMap_CHEMKIN& thermodynamicsMap, TransportPropertiesMap_CHEMKIN* transportMap);
+
+	/**
+	*@brief Opens the binary image and checks its header against the kinetics.xml file
+	*@param fImage the stream, positioned after the header if the image is valid
+	*@param file_image name of the binary image
+	*@param file_xml name of the kinetics.xml file
+	*@param is_transport_available true if the image contains the transport data
+	*@return true if the image is available and consistent with the kinetics.xml file
+	*/
+	bool OpenMechanismBinaryImage(	std::ifstream& fImage, const boost::filesystem::path& file_image, const boost::filesystem::path& file_xml,
+					bool& is_transport_available);
+}
+
+#include "MechanismBinaryImage.hpp"
+
+#endif /* OpenSMOKE_MechanismBinaryImage_H */
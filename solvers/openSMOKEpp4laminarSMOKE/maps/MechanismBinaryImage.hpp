@@ -0,0 +1,190 @@
+/*----------------------------------------------------------------------*\
+|    ___                   ____  __  __  ___  _  _______                  |
+|   / _ \ _ __   ___ _ __ / ___||  \/  |/ _ \| |/ / ____| _     _         |
+|  | | | | '_ \ / _ \ '_ \\___ \| |\/| | | | | ' /|  _| _| |_ _| |_       |
+|  | |_| | |_) |  __/ | | |___) | |  | | |_| | . \| |__|_   _|_   _|      |
+|   \___/| .__/ \___|_| |_|____/|_|  |_|\___/|_|\_\_____||_|   |_|        |
+|        |_|                                                              |
+|                                                                         |
+|   Author: Alberto Cuoci <alberto.cuoci@polimi.it>                       |
+|   CRECK Modeling Group <http://creckmodeling.chem.polimi.it>            |
+|   Department of Chemistry, Materials and Chemical Engineering           |
+|   Politecnico di Milano                                                 |
+|   P.zza Leonardo da Vinci 32, 20133 Milano                              |
+|                                                                         |
+|-------------------------------------------------------------------------|
+|                                                                         |
+|   This file is part of OpenSMOKE++ framework.                           |
+|                                                                         |
+|	License                                                               |
+|                                                                         |
+|   Copyright(C) 2014, 2013, 2012  Alberto Cuoci                          |
+|   OpenSMOKE++ is free software: you can redistribute it and/or modify   |
+|   it under the terms of the GNU General Public License as published by  |
+|   the Free Software Foundation, either version 3 of the License, or     |
+|   (at your option) any later version.                                   |
+|                                                                         |
+|   OpenSMOKE++ is distributed in the hope that it will be useful,        |
+|   but WITHOUT ANY WARRANTY; without even the implied warranty of        |
+|   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         |
+|   GNU General Public License for more details.                          |
+|                                                                         |
+|   You should have received a copy of the GNU General Public License     |
+|   along with OpenSMOKE++. If not, see <http://www.gnu.org/licenses/>.   |
+|                                                                         |
+\*-----------------------------------------------------------------------*/
+
+
+#include "math/OpenSMOKEUtilities.h"
+
+namespace OpenSMOKE
+{
+	uint64_t MechanismBinaryImageChecksum(const boost::filesystem::path& file_name)
+	{
+		std::ifstream fInput(file_name.c_str(), std::ios::in | std::ios::binary);
+		if (!fInput.is_open())
+			ErrorMessage("MechanismBinaryImageChecksum", "Unable to open file: " + file_name.string());
+
+		uint64_t size = 0;
+		return MechanismBinaryImageChecksum(fInput, size);
+	}
+
+	uint64_t MechanismBinaryImageChecksum(std::istream& fInput, uint64_t& size)
+	{
+		uint64_t checksum = 14695981039346656037ULL;
+		size = 0;
+
+		std::vector<char> buffer(1 << 16);
+		while (fInput)
+		{
+			fInput.read(buffer.data(), buffer.size());
+			const std::streamsize n = fInput.gcount();
+			size += n;
+			for (std::streamsize i = 0; i < n; i++)
+			{
+				checksum ^= static_cast<unsigned char>(buffer[i]);
+				checksum *= 1099511628211ULL;
+			}
+		}
+
+		return checksum;
+	}
+
+	void WriteMechanismBinaryImage(	const boost::filesystem::path& file_image, const boost::filesystem::path& file_xml,
+					ThermodynamicsMap_CHEMKIN& thermodynamicsMap, TransportPropertiesMap_CHEMKIN* transportMap)
+	{
+		std::ofstream fImage(file_image.c_str(), std::ios::out | std::ios::binary);
+		if (!fImage.is_open())
+			ErrorMessage("WriteMechanismBinaryImage", "Unable to open file: " + file_image.string());
+
+		// Header
+		char magic[8];
+		std::copy(MECHANISM_BINARY_IMAGE_MAGIC, MECHANISM_BINARY_IMAGE_MAGIC + 8, magic);
+		uint32_t version = MECHANISM_BINARY_IMAGE_VERSION;
+		uint32_t byte_order = MECHANISM_BINARY_IMAGE_BYTE_ORDER;
+		uint32_t size_of_double = sizeof(double);
+		uint32_t transport = (transportMap != nullptr) ? 1 : 0;
+		uint64_t checksum = MechanismBinaryImageChecksum(file_xml);
+		uint64_t data_size = 0;
+		uint64_t data_checksum = 0;
+
+		Save(fImage, OPENSMOKE_BINARY_FILE, 8, magic);
+		Save(fImage, OPENSMOKE_BINARY_FILE, version);
+		Save(fImage, OPENSMOKE_BINARY_FILE, byte_order);
+		Save(fImage, OPENSMOKE_BINARY_FILE, size_of_double);
+		Save(fImage, OPENSMOKE_BINARY_FILE, transport);
+		Save(fImage, OPENSMOKE_BINARY_FILE, checksum);
+		const std::streampos data_position = fImage.tellp();
+		Save(fImage, OPENSMOKE_BINARY_FILE, data_size);
+		Save(fImage, OPENSMOKE_BINARY_FILE, data_checksum);
+		const std::streampos header_end = fImage.tellp();
+
+		// Data
+		thermodynamicsMap.WriteCoefficientsOnBinaryImage(fImage);
+		if (transportMap != nullptr)
+			transportMap->WriteCoefficientsOnBinaryImage(fImage);
+
+		fImage.close();
+		if (!fImage)
+			ErrorMessage("WriteMechanismBinaryImage", "Unable to write file: " + file_image.string());
+
+		// Size and checksum of the data (written in the header only after the data are complete)
+		{
+			std::ifstream fData(file_image.c_str(), std::ios::in | std::ios::binary);
+			fData.seekg(header_end);
+			data_checksum = MechanismBinaryImageChecksum(fData, data_size);
+		}
+		{
+			std::fstream fHeader(file_image.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+			fHeader.seekp(data_position);
+			fHeader.write(reinterpret_cast<const char*>(&data_size), sizeof(data_size));
+			fHeader.write(reinterpret_cast<const char*>(&data_checksum), sizeof(data_checksum));
+			fHeader.close();
+			if (!fHeader)
+				ErrorMessage("WriteMechanismBinaryImage", "Unable to write file: " + file_image.string());
+		}
+	}
+
+	bool OpenMechanismBinaryImage(	std::ifstream& fImage, const boost::filesystem::path& file_image, const boost::filesystem::path& file_xml,
+					bool& is_transport_available)
+	{
+		is_transport_available = false;
+
+		if (!boost::filesystem::exists(file_image))
+			return false;
+
+		fImage.open(file_image.c_str(), std::ios::in | std::ios::binary);
+		if (!fImage.is_open())
+			return false;
+
+		char magic[8];
+		uint32_t version = 0;
+		uint32_t byte_order = 0;
+		uint32_t size_of_double = 0;
+		uint32_t transport = 0;
+		uint64_t checksum = 0;
+		uint64_t data_size = 0;
+		uint64_t data_checksum = 0;
+
+		fImage.read(magic, 8);
+		fImage.read(reinterpret_cast<char*>(&version), sizeof(version));
+		fImage.read(reinterpret_cast<char*>(&byte_order), sizeof(byte_order));
+		fImage.read(reinterpret_cast<char*>(&size_of_double), sizeof(size_of_double));
+		fImage.read(reinterpret_cast<char*>(&transport), sizeof(transport));
+		fImage.read(reinterpret_cast<char*>(&checksum), sizeof(checksum));
+		fImage.read(reinterpret_cast<char*>(&data_size), sizeof(data_size));
+		fImage.read(reinterpret_cast<char*>(&data_checksum), sizeof(data_checksum));
+
+		if (!fImage ||
+			std::equal(magic, magic + 8, MECHANISM_BINARY_IMAGE_MAGIC) == false ||
+			version != MECHANISM_BINARY_IMAGE_VERSION ||
+			byte_order != MECHANISM_BINARY_IMAGE_BYTE_ORDER ||
+			size_of_double != sizeof(double) ||
+			checksum != MechanismBinaryImageChecksum(file_xml))
+		{
+			std::cout << " * The binary image " << file_image.string() << " is not consistent with the XML file and will be ignored" << std::endl;
+			fImage.close();
+			return false;
+		}
+
+		// The data are checked before being loaded (the stream is then positioned again after the header)
+		{
+			const std::streampos header_end = fImage.tellg();
+			uint64_t size = 0;
+			const uint64_t checksum_data = MechanismBinaryImageChecksum(fImage, size);
+			if (size != data_size || checksum_data != data_checksum)
+			{
+				std::cout << " * The binary image " << file_image.string() << " is incomplete or corrupted and will be ignored" << std::endl;
+				fImage.close();
+				return false;
+			}
+
+			fImage.clear();
+			fImage.seekg(header_end);
+		}
+
+		is_transport_available = (transport == 1);
+
+		return true;
+	}
+}
@@ -136,6 +136,35 @@ namespace OpenSMOKE
 		*/
 		void ProductionAndDestructionRatesFromReactionRatesGross(double* P, double* D, const double* rF, const double* rB);
 
+	public:	// Batched evaluation (structure-of-arrays layout: the point index is the innermost, i.e. v[j*nPoints+k])
+
+		/**
+		*@brief Evaluates the product of concentrations for each reaction for a batch of points
+		*@param productDirect product of concentrations of reactants (nReactions x nPoints)
+		*@param productReverse product of concentrations of products (nReactions x nPoints)
+		*@param c concentrations of species (nSpecies x nPoints)
+		*@param nPoints number of points
+		*/
+		void ProductOfConcentrationsBatch(std::vector<double>& productDirect, std::vector<double>& productReverse, const double* c, const unsigned int nPoints);
+
+		/**
+		*@brief Evaluates the formation rates from the reaction rates for a batch of points
+		*@param R formation rates of species (nSpecies x nPoints)
+		*@param r reaction rates (nReactions x nPoints)
+		*@param nPoints number of points
+		*/
+		void FormationRatesFromReactionRatesBatch(double* R, const double* r, const unsigned int nPoints);
+
+		/**
+		*@brief Evaluates the change of a species property (products minus reactants) for each reaction for a batch of points
+		*@param reaction_dphi change of the property for each reaction (nReactions x nPoints)
+		*@param species_phi species property (nSpecies x nPoints)
+		*@param nPoints number of points
+		*/
+		void ReactionChangeOfPropertyBatch(double* reaction_dphi, const double* species_phi, const unsigned int nPoints);
+
+	public:
+
 		/**
 		*@brief Builds the stoichiometric matrix (sparse matrix of course!)
 		*/
@@ -250,6 +279,10 @@ namespace OpenSMOKE
 		std::vector< std::vector<unsigned int> >	non_elementary_reactions_species_indices_reverse_;
 		std::vector< std::vector<double> >			non_elementary_reactions_orders_reverse_;
 
+		std::vector<double> batch_c2_;		//!< square of concentrations (batched evaluation)
+		std::vector<double> batch_c3_;		//!< cube of concentrations (batched evaluation)
+		std::vector<double> batch_csq_;		//!< square root of concentrations (batched evaluation)
+
 	};
 }
 
@@ -1240,6 +1240,316 @@ namespace OpenSMOKE
 		}
 	}
 
+	void StoichiometricMap::ProductOfConcentrationsBatch(std::vector<double>& productDirect, std::vector<double>& productReverse, const double* c, const unsigned int nPoints)
+	{
+		std::fill(productDirect.begin(), productDirect.end(), 1.);
+		std::fill(productReverse.begin(), productReverse.end(), 1.);
+
+		batch_c2_.resize(nPoints);
+		batch_c3_.resize(nPoints);
+		batch_csq_.resize(nPoints);
+		double* c2 = batch_c2_.data();
+		double* c3 = batch_c3_.data();
+		double* csq = batch_csq_.data();
+
+		unsigned int *jD1 = lambda_jDir1_.data();
+		unsigned int *jD2 = lambda_jDir2_.data();
+		unsigned int *jD3 = lambda_jDir3_.data();
+		unsigned int *jD4 = lambda_jDir4_.data();
+		unsigned int *jD5 = lambda_jDir5_.data();
+		double* vD5 = lambda_valueDir5_.data();
+
+		unsigned int *jIE1 = lambda_jRevEq1_.data();
+		unsigned int *jIE2 = lambda_jRevEq2_.data();
+		unsigned int *jIE3 = lambda_jRevEq3_.data();
+		unsigned int *jIE4 = lambda_jRevEq4_.data();
+		unsigned int *jIE5 = lambda_jRevEq5_.data();
+		double *vIE5 = lambda_valueRevEq5_.data();
+
+		for (unsigned int i = 0; i < number_of_species_; i++)
+		{
+			const double* c1 = c + i*nPoints;
+			for (unsigned int p = 0; p < nPoints; p++)
+			{
+				c2[p] = c1[p] * c1[p];
+				c3[p] = c2[p] * c1[p];
+			}
+			if (lambda_numDir4_[i] != 0 || lambda_numRevEq4_[i] != 0)
+				for (unsigned int p = 0; p < nPoints; p++)
+					csq[p] = std::sqrt(c1[p]);
+
+			for (unsigned int k = 0; k < lambda_numDir1_[i]; k++)
+			{
+				double* product = productDirect.data() + (*jD1++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					product[p] *= c1[p];
+			}
+			for (unsigned int k = 0; k < lambda_numDir2_[i]; k++)
+			{
+				double* product = productDirect.data() + (*jD2++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					product[p] *= c2[p];
+			}
+			for (unsigned int k = 0; k < lambda_numDir3_[i]; k++)
+			{
+				double* product = productDirect.data() + (*jD3++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					product[p] *= c3[p];
+			}
+			for (unsigned int k = 0; k < lambda_numDir4_[i]; k++)
+			{
+				double* product = productDirect.data() + (*jD4++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					product[p] *= csq[p];
+			}
+			for (unsigned int k = 0; k < lambda_numDir5_[i]; k++)
+			{
+				double* product = productDirect.data() + (*jD5++)*nPoints;
+				const double lambda = *vD5++;
+				for (unsigned int p = 0; p < nPoints; p++)
+					product[p] *= std::pow(c1[p], lambda);
+			}
+
+			for (unsigned int k = 0; k < lambda_numRevEq1_[i]; k++)
+			{
+				double* product = productReverse.data() + (*jIE1++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					product[p] *= c1[p];
+			}
+			for (unsigned int k = 0; k < lambda_numRevEq2_[i]; k++)
+			{
+				double* product = productReverse.data() + (*jIE2++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					product[p] *= c2[p];
+			}
+			for (unsigned int k = 0; k < lambda_numRevEq3_[i]; k++)
+			{
+				double* product = productReverse.data() + (*jIE3++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					product[p] *= c3[p];
+			}
+			for (unsigned int k = 0; k < lambda_numRevEq4_[i]; k++)
+			{
+				double* product = productReverse.data() + (*jIE4++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					product[p] *= csq[p];
+			}
+			for (unsigned int k = 0; k < lambda_numRevEq5_[i]; k++)
+			{
+				double* product = productReverse.data() + (*jIE5++)*nPoints;
+				const double lambda = *vIE5++;
+				for (unsigned int p = 0; p < nPoints; p++)
+					product[p] *= std::pow(c1[p], lambda);
+			}
+		}
+
+		// Non elementary reactions (reaction orders different from stoichiometric coefficients)
+		if (non_elementary_reactions_direct_ != 0 || non_elementary_reactions_reverse_ != 0)
+		{
+			std::vector<double> cPoint(number_of_species_);
+			std::vector<double> productDirectPoint(number_of_reactions_);
+			std::vector<double> productReversePoint(number_of_reactions_);
+
+			for (unsigned int p = 0; p < nPoints; p++)
+			{
+				for (unsigned int i = 0; i < number_of_species_; i++)
+					cPoint[i] = c[i*nPoints + p];
+				for (unsigned int j = 0; j < number_of_reactions_; j++)
+				{
+					productDirectPoint[j] = productDirect[j*nPoints + p];
+					productReversePoint[j] = productReverse[j*nPoints + p];
+				}
+
+				ProductOfConcentrationsForNonElementaryReactions(productDirectPoint, productReversePoint, cPoint.data());
+
+				for (unsigned int j = 0; j < number_of_reactions_; j++)
+				{
+					if (is_non_elementary_reaction_direct_[j] == true)
+						productDirect[j*nPoints + p] = productDirectPoint[j];
+					if (is_non_elementary_reaction_reverse_[j] == true)
+						productReverse[j*nPoints + p] = productReversePoint[j];
+				}
+			}
+		}
+	}
+
+	void StoichiometricMap::FormationRatesFromReactionRatesBatch(double* R, const double* r, const unsigned int nPoints)
+	{
+		unsigned int* jD1 = jDir1_.data();
+		unsigned int* jD2 = jDir2_.data();
+		unsigned int* jD3 = jDir3_.data();
+		unsigned int* jD4 = jDir4_.data();
+		unsigned int* jD5 = jDir5_.data();
+		double* vD5 = valueDir5_.data();
+
+		unsigned int* jIT1 = jRevTot1_.data();
+		unsigned int* jIT2 = jRevTot2_.data();
+		unsigned int* jIT3 = jRevTot3_.data();
+		unsigned int* jIT4 = jRevTot4_.data();
+		unsigned int* jIT5 = jRevTot5_.data();
+		double* vIT5 = valueRevTot5_.data();
+
+		for (unsigned int i = 0; i < number_of_species_; i++)
+		{
+			double* rate = R + i*nPoints;
+			for (unsigned int p = 0; p < nPoints; p++)
+				rate[p] = 0.;
+
+			for (unsigned int k = 0; k < numDir1_[i]; k++)
+			{
+				const double* rj = r + (*jD1++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					rate[p] -= rj[p];
+			}
+			for (unsigned int k = 0; k < numDir2_[i]; k++)
+			{
+				const double* rj = r + (*jD2++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					rate[p] -= (rj[p] + rj[p]);
+			}
+			for (unsigned int k = 0; k < numDir3_[i]; k++)
+			{
+				const double* rj = r + (*jD3++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					rate[p] -= (rj[p] + rj[p] + rj[p]);
+			}
+			for (unsigned int k = 0; k < numDir4_[i]; k++)
+			{
+				const double* rj = r + (*jD4++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					rate[p] -= 0.5 * rj[p];
+			}
+			for (unsigned int k = 0; k < numDir5_[i]; k++)
+			{
+				const double* rj = r + (*jD5++)*nPoints;
+				const double nu = *vD5++;
+				for (unsigned int p = 0; p < nPoints; p++)
+					rate[p] -= nu * rj[p];
+			}
+
+			for (unsigned int k = 0; k < numRevTot1_[i]; k++)
+			{
+				const double* rj = r + (*jIT1++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					rate[p] += rj[p];
+			}
+			for (unsigned int k = 0; k < numRevTot2_[i]; k++)
+			{
+				const double* rj = r + (*jIT2++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					rate[p] += (rj[p] + rj[p]);
+			}
+			for (unsigned int k = 0; k < numRevTot3_[i]; k++)
+			{
+				const double* rj = r + (*jIT3++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					rate[p] += (rj[p] + rj[p] + rj[p]);
+			}
+			for (unsigned int k = 0; k < numRevTot4_[i]; k++)
+			{
+				const double* rj = r + (*jIT4++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					rate[p] += 0.5 * rj[p];
+			}
+			for (unsigned int k = 0; k < numRevTot5_[i]; k++)
+			{
+				const double* rj = r + (*jIT5++)*nPoints;
+				const double nu = *vIT5++;
+				for (unsigned int p = 0; p < nPoints; p++)
+					rate[p] += nu * rj[p];
+			}
+		}
+	}
+
+	void StoichiometricMap::ReactionChangeOfPropertyBatch(double* reaction_dphi, const double* species_phi, const unsigned int nPoints)
+	{
+		unsigned int *jD1 = jDir1_.data();
+		unsigned int *jD2 = jDir2_.data();
+		unsigned int *jD3 = jDir3_.data();
+		unsigned int *jD4 = jDir4_.data();
+		unsigned int *jD5 = jDir5_.data();
+		double *vD5 = valueDir5_.data();
+
+		unsigned int *jIT1 = jRevTot1_.data();
+		unsigned int *jIT2 = jRevTot2_.data();
+		unsigned int *jIT3 = jRevTot3_.data();
+		unsigned int *jIT4 = jRevTot4_.data();
+		unsigned int *jIT5 = jRevTot5_.data();
+		double *vIT5 = valueRevTot5_.data();
+
+		for (unsigned int j = 0; j < number_of_reactions_*nPoints; j++)
+			reaction_dphi[j] = 0.;
+
+		for (unsigned int i = 0; i < number_of_species_; i++)
+		{
+			const double* phi = species_phi + i*nPoints;
+
+			for (unsigned int k = 0; k < numDir1_[i]; k++)
+			{
+				double* dphi = reaction_dphi + (*jD1++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					dphi[p] -= phi[p];
+			}
+			for (unsigned int k = 0; k < numDir2_[i]; k++)
+			{
+				double* dphi = reaction_dphi + (*jD2++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					dphi[p] -= (phi[p] + phi[p]);
+			}
+			for (unsigned int k = 0; k < numDir3_[i]; k++)
+			{
+				double* dphi = reaction_dphi + (*jD3++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					dphi[p] -= (phi[p] + phi[p] + phi[p]);
+			}
+			for (unsigned int k = 0; k < numDir4_[i]; k++)
+			{
+				double* dphi = reaction_dphi + (*jD4++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					dphi[p] -= 0.5 * phi[p];
+			}
+			for (unsigned int k = 0; k < numDir5_[i]; k++)
+			{
+				double* dphi = reaction_dphi + (*jD5++)*nPoints;
+				const double nu = *vD5++;
+				for (unsigned int p = 0; p < nPoints; p++)
+					dphi[p] -= nu * phi[p];
+			}
+
+			for (unsigned int k = 0; k < numRevTot1_[i]; k++)
+			{
+				double* dphi = reaction_dphi + (*jIT1++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					dphi[p] += phi[p];
+			}
+			for (unsigned int k = 0; k < numRevTot2_[i]; k++)
+			{
+				double* dphi = reaction_dphi + (*jIT2++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					dphi[p] += (phi[p] + phi[p]);
+			}
+			for (unsigned int k = 0; k < numRevTot3_[i]; k++)
+			{
+				double* dphi = reaction_dphi + (*jIT3++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					dphi[p] += (phi[p] + phi[p] + phi[p]);
+			}
+			for (unsigned int k = 0; k < numRevTot4_[i]; k++)
+			{
+				double* dphi = reaction_dphi + (*jIT4++)*nPoints;
+				for (unsigned int p = 0; p < nPoints; p++)
+					dphi[p] += 0.5 * phi[p];
+			}
+			for (unsigned int k = 0; k < numRevTot5_[i]; k++)
+			{
+				double* dphi = reaction_dphi + (*jIT5++)*nPoints;
+				const double nu = *vIT5++;
+				for (unsigned int p = 0; p < nPoints; p++)
+					dphi[p] += nu * phi[p];
+			}
+		}
+	}
+
 	void StoichiometricMap::EquilibriumConstants(double* Kp, const double* exp_g_over_RT, const double Patm_over_RT)
 	{
 		for (unsigned int i = 0; i<number_of_reactions_; i++)
@@ -0,0 +1,154 @@
+/*-----------------------------------------------------------------------*\
+|    ___                   ____  __  __  ___  _  _______                  |
+|   / _ \ _ __   ___ _ __ / ___||  \/  |/ _ \| |/ / ____| _     _         |
+|  | | | | '_ \ / _ \ '_ \\___ \| |\/| | | | | ' /|  _| _| |_ _| |_       |
+|  | |_| | |_) |  __/ | | |___) | |  | | |_| | . \| |__|_   _|_   _|      |
+|   \___/| .__/ \___|_| |_|____/|_|  |_|\___/|_|\_\_____||_|   |_|        |
+|        |_|                                                              |
+|                                                                         |
+|   Author: Alberto Cuoci <alberto.cuoci@polimi.it>                       |
+|   CRECK Modeling Group <http://creckmodeling.chem.polimi.it>            |
+|   Department of Chemistry, Materials and Chemical Engineering           |
+|   Politecnico di Milano                                                 |
+|   P.zza Leonardo da Vinci 32, 20133 Milano                              |
+|                                                                         |
+|-------------------------------------------------------------------------|
+|                                                                         |
+|   This file is part of OpenSMOKE++ framework.                           |
+|                                                                         |
+|	License                                                           |
+|                                                                         |
+|   Copyright(C) 2014, 2013, 2012  Alberto Cuoci                          |
+|   OpenSMOKE++ is free software: you can redistribute it and/or modify   |
+|   it under the terms of the GNU General Public License as published by  |
+|   the Free Software Foundation, either version 3 of the License, or     |
+|   (at your option) any later version.                                   |
+|                                                                         |
+|   OpenSMOKE++ is distributed in the hope that it will be useful,        |
+|   but WITHOUT ANY WARRANTY; without even the implied warranty of        |
+|   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         |
+|   GNU General Public License for more details.                          |
+|                                                                         |
+|   You should have received a copy of the GNU General Public License     |
+|   along with OpenSMOKE++. If not, see <http://www.gnu.org/licenses/>.   |
+|                                                                         |
+\*-----------------------------------------------------------------------*/
+
+
+#ifndef OpenSMOKE_TemperatureTable_H
+#define OpenSMOKE_TemperatureTable_H
+
+#include <vector>
+#include <string>
+#include <ostream>
+
+namespace OpenSMOKE
+{
+	//!  A class to tabulate properties depending only on the temperature
+	/*!
+	This class stores a set of properties on a uniform temperature grid and evaluates them
+	through linear or cubic (4-point Lagrange) interpolation. Values are stored node by node
+	(all the properties of a node are contiguous), so that an interpolation reads only 2 (linear)
+	or 4 (cubic) contiguous rows of the table. The table is filled and verified by the maps
+	which own the fitting coefficients (see ThermodynamicsMap_CHEMKIN and TransportPropertiesMap_CHEMKIN).
+	*/
+
+	class TemperatureTable
+	{
+	public:
+
+		enum Interpolation { TEMPERATURE_TABLE_LINEAR, TEMPERATURE_TABLE_CUBIC };
+
+		/**
+		*@brief Creates an empty table
+		*@param name name of the tabulated property (used only for reporting)
+		*@param n number of properties stored for each temperature
+		*@param Tmin minimum temperature of the interpolation range [K]
+		*@param Tmax maximum temperature of the interpolation range [K]
+		*@param dT temperature step [K]
+		*@param interpolation interpolation type
+		*/
+		TemperatureTable(	const std::string& name, const unsigned int n, const double Tmin, const double Tmax, 
+					const double dT, const Interpolation interpolation);
+
+		/**
+		*@brief Returns true if the temperature is inside the interpolation range
+		*/
+		bool InRange(const double T) const { return (T >= Tmin_ && T <= Tmax_); }
+
+		/**
+		*@brief Interpolates all the properties at the given temperature (which must be in range)
+		*@param T temperature [K]
+		*@param y interpolated properties (n values)
+		*/
+		void Interpolate(const double T, double* y) const;
+
+		/**
+		*@brief Returns the number of nodes of the grid
+		*/
+		unsigned int NumberOfNodes() const { return nodes_; }
+
+		/**
+		*@brief Returns the temperature of a node of the grid [K]
+		*/
+		double Temperature(const unsigned int k) const { return T0_ + k*dT_; }
+
+		/**
+		*@brief Returns the properties stored in a node of the grid (n values, to be filled by the map)
+		*/
+		double* Node(const unsigned int k) { return &table_[k*n_]; }
+
+		/**
+		*@brief Compares the interpolated properties with the exact values at a given temperature
+		*       and updates the maximum relative error of the table
+		*@param T temperature [K]
+		*@param exact exact values (n values)
+		*@param threshold values smaller than this threshold (in absolute value) are compared in absolute terms
+		*/
+		void Verify(const double T, const double* exact, const double threshold);
+
+		/**
+		*@brief Returns the maximum relative error found during the verification
+		*/
+		double MaxRelativeError() const { return max_error_; }
+
+		/**
+		*@brief Writes a summary of the table and of the verification
+		*/
+		void Summary(std::ostream& out) const;
+
+		/**
+		*@brief Returns the memory occupied by the table [MB]
+		*/
+		double Memory() const { return table_.size()*sizeof(double)/1024./1024.; }
+
+		/**
+		*@brief Returns the temperature step [K]
+		*/
+		double Step() const { return dT_; }
+
+	private:
+
+		std::string name_;			//!< name of the tabulated property
+		unsigned int n_;			//!< number of properties for each temperature
+		unsigned int nodes_;			//!< number of nodes of the grid
+		Interpolation interpolation_;		//!< interpolation type
+
+		double Tmin_;				//!< minimum temperature of the interpolation range [K]
+		double Tmax_;				//!< maximum temperature of the interpolation range [K]
+		double T0_;				//!< temperature of the first node [K]
+		double dT_;				//!< temperature step [K]
+		double udT_;				//!< reciprocal of the temperature step [1/K]
+
+		std::vector<double> table_;		//!< tabulated values (node by node)
+		std::vector<double> aux_;		//!< auxiliary vector used by the verification
+
+		double max_error_;			//!< maximum relative error found during the verification
+		double T_max_error_;			//!< temperature corresponding to the maximum relative error [K]
+		unsigned int index_max_error_;		//!< index of property (0-based) corresponding to the maximum relative error
+	};
+}
+
+#include "TemperatureTable.hpp"
+
+#endif /* OpenSMOKE_TemperatureTable_H */
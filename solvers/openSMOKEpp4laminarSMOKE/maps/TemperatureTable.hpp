@@ -0,0 +1,137 @@
+/*-----------------------------------------------------------------------*\
+|    ___                   ____  __  __  ___  _  _______                  |
+|   / _ \ _ __   ___ _ __ / ___||  \/  |/ _ \| |/ / ____| _     _         |
+|  | | | | '_ \ / _ \ '_ \\___ \| |\/| | | | | ' /|  _| _| |_ _| |_       |
+|  | |_| | |_) |  __/ | | |___) | |  | | |_| | . \| |__|_   _|_   _|      |
+|   \___/| .__/ \___|_| |_|____/|_|  |_|\___/|_|\_\_____||_|   |_|        |
+|        |_|                                                              |
+|                                                                         |
+|   Author: Alberto Cuoci <alberto.cuoci@polimi.it>                       |
+|   CRECK Modeling Group <http://creckmodeling.chem.polimi.it>            |
+|   Department of Chemistry, Materials and Chemical Engineering           |
+|   Politecnico di Milano                                                 |
+|   P.zza Leonardo da Vinci 32, 20133 Milano                              |
+|                                                                         |
+|-------------------------------------------------------------------------|
+|                                                                         |
+|   This file is part of OpenSMOKE++ framework.                           |
+|                                                                         |
+|	License                                                           |
+|                                                                         |
+|   Copyright(C) 2014, 2013, 2012  Alberto Cuoci                          |
+|   OpenSMOKE++ is free software: you can redistribute it and/or modify   |
+|   it under the terms of the GNU General Public License as published by  |
+|   the Free Software Foundation, either version 3 of the License, or     |
+|   (at your option) any later version.                                   |
+|                                                                         |
+|   OpenSMOKE++ is distributed in the hope that it will be useful,        |
+|   but WITHOUT ANY WARRANTY; without even the implied warranty of        |
+|   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         |
+|   GNU General Public License for more details.                          |
+|                                                                         |
+|   You should have received a copy of the GNU General Public License     |
+|   along with OpenSMOKE++. If not, see <http://www.gnu.org/licenses/>.   |
+|                                                                         |
+\*-----------------------------------------------------------------------*/
+
+
+#include <cmath>
+#include <algorithm>
+#include <iomanip>
+
+namespace OpenSMOKE
+{
+	TemperatureTable::TemperatureTable(	const std::string& name, const unsigned int n, const double Tmin, const double Tmax, 
+						const double dT, const Interpolation interpolation)
+	{
+		name_ = name;
+		n_ = n;
+		interpolation_ = interpolation;
+
+		Tmin_ = Tmin;
+		Tmax_ = Tmax;
+		dT_ = dT;
+		udT_ = 1./dT;
+
+		// One additional node on the left and two on the right, so that the cubic 
+		// interpolation can always use 4 nodes in the whole range [Tmin,Tmax]
+		T0_ = Tmin_ - dT_;
+		nodes_ = static_cast<unsigned int>(std::ceil((Tmax_-Tmin_)*udT_)) + 4;
+
+		table_.resize(nodes_*n_);
+		aux_.resize(n_);
+		std::fill(table_.begin(), table_.end(), 0.);
+
+		max_error_ = 0.;
+		T_max_error_ = Tmin_;
+		index_max_error_ = 0;
+	}
+
+	void TemperatureTable::Interpolate(const double T, double* y) const
+	{
+		const double x = (T - T0_)*udT_;
+		const unsigned int k = static_cast<unsigned int>(x);
+		const double t = x - k;
+
+		const double* a = &table_[k*n_];
+		const double* b = a + n_;
+
+		if (interpolation_ == TEMPERATURE_TABLE_LINEAR)
+		{
+			for (unsigned int j=0;j<n_;j++)
+				y[j] = a[j] + t*(b[j]-a[j]);
+		}
+		else
+		{
+			const double* am = a - n_;
+			const double* bp = b + n_;
+
+			const double tm = t + 1.;
+			const double t1 = t - 1.;
+			const double t2 = t - 2.;
+
+			const double wam = -t*t1*t2/6.;
+			const double wa  =  tm*t1*t2/2.;
+			const double wb  = -tm*t*t2/2.;
+			const double wbp =  tm*t*t1/6.;
+
+			for (unsigned int j=0;j<n_;j++)
+				y[j] = wam*am[j] + wa*a[j] + wb*b[j] + wbp*bp[j];
+		}
+	}
+
+	void TemperatureTable::Verify(const double T, const double* exact, const double threshold)
+	{
+		Interpolate(T, aux_.data());
+
+		for (unsigned int j=0;j<n_;j++)
+		{
+			const double error = std::fabs(aux_[j]-exact[j])/std::max(std::fabs(exact[j]), threshold);
+			if (error > max_error_)
+			{
+				max_error_ = error;
+				T_max_error_ = T;
+				index_max_error_ = j;
+			}
+		}
+	}
+
+	void TemperatureTable::Summary(std::ostream& out) const
+	{
+		const std::ios_base::fmtflags flags = out.flags();
+		const std::streamsize precision = out.precision();
+
+		out << "   " << std::left << std::setw(24) << name_;
+		out << std::right << std::setw(8) << n_;
+		out << std::setw(10) << nodes_;
+		out << std::setw(10) << std::fixed << std::setprecision(3) << dT_;
+		out << std::setw(12) << std::setprecision(2) << Memory();
+		out << std::setw(14) << std::scientific << std::setprecision(3) << max_error_;
+		out << std::setw(10) << std::fixed << std::setprecision(1) << T_max_error_;
+		out << std::setw(8) << index_max_error_+1;
+		out << std::endl;
+
+		out.flags(flags);
+		out.precision(precision);
+	}
+}
@@ -39,6 +39,8 @@
 
 #include "ThermodynamicsMap.h"
 #include "rapidxml.hpp"
+#include "TemperatureTable.h"
+#include <boost/shared_ptr.hpp>
 
 namespace OpenSMOKE
 {
@@ -74,6 +76,13 @@ namespace OpenSMOKE
 		*/
 		ThermodynamicsMap_CHEMKIN(rapidxml::xml_document<>& doc, bool verbose);
 
+		/**
+		*@brief Creates a thermodynamic map reading the coefficients from the binary image of the mechanism
+		*@param doc file in XML format (only the names of species and elements are read)
+		*@param fImage binary image of the mechanism, already positioned after the header
+		*/
+		ThermodynamicsMap_CHEMKIN(rapidxml::xml_document<>& doc, std::ifstream& fImage);
+
 		/**
 		*@brief Copy constructor
 		*@param rhs the object to be copied in the current object
@@ -253,6 +262,18 @@ namespace OpenSMOKE
 		*/
 		virtual void ImportSpeciesFromXMLFile(rapidxml::xml_document<>& doc);
 
+		/**
+		*@brief Import the coefficients from the binary image of the mechanism
+		*@param fImage binary image of the mechanism
+		*/
+		void ImportCoefficientsFromBinaryImage(std::ifstream& fImage);
+
+		/**
+		*@brief Writes the coefficients on the binary image of the mechanism
+		*@param fImage binary image of the mechanism
+		*/
+		void WriteCoefficientsOnBinaryImage(std::ofstream& fImage);
+
 		/**
 		*@brief Calculates the derivatives of concentrations of species (in kmol/m3)
 		*       with respect to mass fractions of species.
@@ -337,6 +358,27 @@ namespace OpenSMOKE
 		*/
 		void Change_a_HT(const unsigned int species, const unsigned int j, const double value);
 
+		/**
+		*@brief Replaces the NASA polynomials of species (specific heats, enthalpies and entropies) with the 
+		*       interpolation on a uniform temperature grid. For each property the step is halved until the 
+		*       maximum relative error, checked at the midpoints of the grid intervals, is below the requested 
+		*       tolerance. Outside the range [Tmin,Tmax] the NASA polynomials are used. The tables are shared 
+		*       by copies of the map and are discarded if the NASA coefficients are changed.
+		*@param Tmin minimum temperature [K]
+		*@param Tmax maximum temperature [K]
+		*@param dT initial temperature step [K]
+		*@param interpolation interpolation type (linear or cubic)
+		*@param max_error maximum relative error
+		*@param out stream on which the verification report is written
+		*/
+		void Tabulate(	const double Tmin, const double Tmax, const double dT, 
+				const TemperatureTable::Interpolation interpolation, const double max_error, std::ostream& out);
+
+		/**
+		*@brief Returns true if the species properties are interpolated from tables
+		*/
+		bool is_tabulated() const { return tabulated_; }
+
 
 	protected:
 
@@ -438,6 +480,17 @@ namespace OpenSMOKE
 		bool s_must_be_recalculated_;		/**< true if s of species have to be recalculated */
 
 		bool verbose_output_;			/**< Print video info  */
+
+		bool tabulated_ = false;				/**< true if the species properties are interpolated from tables */
+		boost::shared_ptr<TemperatureTable> table_cp_;		/**< tabulated specific heats (cp/R) */
+		boost::shared_ptr<TemperatureTable> table_h_;		/**< tabulated enthalpies (h/RT) */
+		boost::shared_ptr<TemperatureTable> table_s_;		/**< tabulated entropies (s/R) */
+
+		/**
+		*@brief Creates and verifies the table of a species property (0: cp, 1: h, 2: s)
+		*/
+		boost::shared_ptr<TemperatureTable> TabulateProperty(	const unsigned int property, const double Tmin, const double Tmax, const double dT, 
+									const TemperatureTable::Interpolation interpolation, const double max_error);
 	};
 }
 
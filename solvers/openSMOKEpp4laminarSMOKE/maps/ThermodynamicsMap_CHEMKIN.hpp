@@ -66,6 +66,16 @@ namespace OpenSMOKE
 		ImportCoefficientsFromXMLFile(doc);
 	}
     
+	ThermodynamicsMap_CHEMKIN::ThermodynamicsMap_CHEMKIN(rapidxml::xml_document<>& doc, std::ifstream& fImage)
+	{
+		this->verbose_output_ = true;
+
+		ImportSpeciesFromXMLFile(doc);
+		this->ImportElementsFromXMLFile(doc);
+		MemoryAllocation();
+		ImportCoefficientsFromBinaryImage(fImage);
+	}
+
 	ThermodynamicsMap_CHEMKIN::ThermodynamicsMap_CHEMKIN( const ThermodynamicsMap_CHEMKIN& rhs )
     {
         CopyFromMap(rhs);
@@ -110,6 +120,11 @@ namespace OpenSMOKE
 
         for (unsigned int i=0;i<this->nspecies_;i++)
             this->TM[i] = rhs.TM[i]; 
+
+		this->tabulated_ = rhs.tabulated_;
+		this->table_cp_ = rhs.table_cp_;
+		this->table_h_ = rhs.table_h_;
+		this->table_s_ = rhs.table_s_;
     }
 	  
 	ThermodynamicsMap_CHEMKIN::~ThermodynamicsMap_CHEMKIN(void)
@@ -170,6 +185,8 @@ namespace OpenSMOKE
 
 	void ThermodynamicsMap_CHEMKIN::Change_a_HT(const unsigned int species, const unsigned int j, const double value)
 	{
+		// The tables (if any) are no longer consistent with the coefficients
+		tabulated_ = false;
 
 		const unsigned int i1 = species * 5 + (j - 1);
 		const unsigned int i2 = species * 6 + (j - 1);
@@ -216,6 +233,8 @@ namespace OpenSMOKE
 
 	void ThermodynamicsMap_CHEMKIN::Change_a_LT(const unsigned int species, const unsigned int j, const double value)
 	{
+		// The tables (if any) are no longer consistent with the coefficients
+		tabulated_ = false;
 
 		const unsigned int i1 = species * 5 + (j - 1);
 		const unsigned int i2 = species * 6 + (j - 1);
@@ -356,6 +375,48 @@ namespace OpenSMOKE
 		}
 	}
  
+	void ThermodynamicsMap_CHEMKIN::ImportCoefficientsFromBinaryImage(std::ifstream& fImage)
+	{
+		if (verbose_output_ == true)
+			std::cout << " * Reading thermodynamic coefficients of species from binary image..." << std::endl;
+
+		unsigned int nspecies = 0;
+		Load(fImage, OPENSMOKE_BINARY_FILE, nspecies);
+		if (nspecies != this->nspecies_)
+			ErrorMessage("ThermodynamicsMap_CHEMKIN::ImportCoefficientsFromBinaryImage", "The binary image does not match the number of species.");
+
+		Load(fImage, OPENSMOKE_BINARY_FILE, 5*this->nspecies_, Cp_LT);
+		Load(fImage, OPENSMOKE_BINARY_FILE, 5*this->nspecies_, Cp_HT);
+		Load(fImage, OPENSMOKE_BINARY_FILE, 6*this->nspecies_, DH_LT);
+		Load(fImage, OPENSMOKE_BINARY_FILE, 6*this->nspecies_, DH_HT);
+		Load(fImage, OPENSMOKE_BINARY_FILE, 6*this->nspecies_, DS_LT);
+		Load(fImage, OPENSMOKE_BINARY_FILE, 6*this->nspecies_, DS_HT);
+		Load(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, TL);
+		Load(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, TH);
+		Load(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, TM);
+		Load(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, this->MW__.data());
+
+		if (!fImage)
+			ErrorMessage("ThermodynamicsMap_CHEMKIN::ImportCoefficientsFromBinaryImage", "The binary image cannot be read.");
+	}
+
+	void ThermodynamicsMap_CHEMKIN::WriteCoefficientsOnBinaryImage(std::ofstream& fImage)
+	{
+		unsigned int nspecies = this->nspecies_;
+		Save(fImage, OPENSMOKE_BINARY_FILE, nspecies);
+
+		Save(fImage, OPENSMOKE_BINARY_FILE, 5*this->nspecies_, Cp_LT);
+		Save(fImage, OPENSMOKE_BINARY_FILE, 5*this->nspecies_, Cp_HT);
+		Save(fImage, OPENSMOKE_BINARY_FILE, 6*this->nspecies_, DH_LT);
+		Save(fImage, OPENSMOKE_BINARY_FILE, 6*this->nspecies_, DH_HT);
+		Save(fImage, OPENSMOKE_BINARY_FILE, 6*this->nspecies_, DS_LT);
+		Save(fImage, OPENSMOKE_BINARY_FILE, 6*this->nspecies_, DS_HT);
+		Save(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, TL);
+		Save(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, TH);
+		Save(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, TM);
+		Save(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, this->MW__.data());
+	}
+
 	void ThermodynamicsMap_CHEMKIN::ImportSpeciesFromXMLFile(rapidxml::xml_document<>& doc)
 	{
 		rapidxml::xml_node<>* opensmoke_node = doc.first_node("opensmoke");
@@ -437,6 +498,13 @@ namespace OpenSMOKE
 	{
 		if (cp_must_be_recalculated_ == true)
 		{
+			if (tabulated_ == true && table_cp_->InRange(this->T_) == true)
+			{
+				table_cp_->Interpolate(this->T_, species_cp_over_R__.data());
+				cp_must_be_recalculated_ = false;
+				return;
+			}
+
 			const double T2 = this->T_*this->T_;
 			const double T3 = T2*this->T_;
 			const double T4 = T3*this->T_;
@@ -457,6 +525,13 @@ namespace OpenSMOKE
 	{
 		if (h_must_be_recalculated_ == true)
 		{
+			if (tabulated_ == true && table_h_->InRange(this->T_) == true)
+			{
+				table_h_->Interpolate(this->T_, species_h_over_RT__.data());
+				h_must_be_recalculated_ = false;
+				return;
+			}
+
 			const double T2 = this->T_*this->T_;
 			const double T3 = T2*this->T_;
 			const double T4 = T3*this->T_;
@@ -478,6 +553,13 @@ namespace OpenSMOKE
 	{
 		if (s_must_be_recalculated_ == true)
 		{
+			if (tabulated_ == true && table_s_->InRange(this->T_) == true)
+			{
+				table_s_->Interpolate(this->T_, species_s_over_R__.data());
+				s_must_be_recalculated_ = false;
+				return;
+			}
+
 			const double logT = std::log(this->T_);
 			const double T2 = this->T_*this->T_;
 			const double T3 = T2*this->T_;
@@ -985,4 +1067,88 @@ namespace OpenSMOKE
 				coefficients[j*this->nspecies_ + i] = sub_coefficients[j];
 		}
 	}
+
+	boost::shared_ptr<TemperatureTable> ThermodynamicsMap_CHEMKIN::TabulateProperty(	const unsigned int property, const double Tmin, const double Tmax, const double dT, 
+												const TemperatureTable::Interpolation interpolation, const double max_error)
+	{
+		const unsigned int max_refinements = 4;
+
+		std::string name;
+		if (property == 0)	name = "specific heat";
+		else if (property == 1)	name = "enthalpy";
+		else			name = "entropy";
+
+		// The exact values are calculated through the NASA polynomials
+		const bool tabulated_backup = tabulated_;
+		tabulated_ = false;
+
+		const std::vector<double>& species_property = (property == 0) ? species_cp_over_R__ : ( (property == 1) ? species_h_over_RT__ : species_s_over_R__ );
+
+		boost::shared_ptr<TemperatureTable> table;
+		double step = dT;
+		for (unsigned int k=0;k<=max_refinements;k++)
+		{
+			table.reset(new TemperatureTable(name, this->nspecies_, Tmin, Tmax, step, interpolation));
+
+			for (unsigned int j=0;j<table->NumberOfNodes();j++)
+			{
+				SetTemperature(table->Temperature(j));
+				if (property == 0)	cp_over_R();
+				else if (property == 1)	h_over_RT();
+				else			s_over_R();
+
+				for (unsigned int i=0;i<this->nspecies_;i++)
+					table->Node(j)[i] = species_property[i];
+			}
+
+			// Verification at the midpoints of the grid intervals (i.e. where the error is maximum)
+			// Enthalpies and entropies can cross zero: values smaller than 1 (in absolute value)
+			// are compared in absolute terms
+			for (unsigned int j=1;j<table->NumberOfNodes()-3;j++)
+			{
+				SetTemperature(table->Temperature(j)+0.50*step);
+				if (property == 0)	cp_over_R();
+				else if (property == 1)	h_over_RT();
+				else			s_over_R();
+
+				table->Verify(this->T_, species_property.data(), 1.);
+			}
+
+			if (table->MaxRelativeError() <= max_error)
+				break;
+
+			step *= 0.50;
+		}
+
+		tabulated_ = tabulated_backup;
+
+		return table;
+	}
+
+	void ThermodynamicsMap_CHEMKIN::Tabulate(	const double Tmin, const double Tmax, const double dT, 
+							const TemperatureTable::Interpolation interpolation, const double max_error, std::ostream& out)
+	{
+		const double T_backup = this->T_;
+
+		table_cp_ = TabulateProperty(0, Tmin, Tmax, dT, interpolation, max_error);
+		table_h_ = TabulateProperty(1, Tmin, Tmax, dT, interpolation, max_error);
+		table_s_ = TabulateProperty(2, Tmin, Tmax, dT, interpolation, max_error);
+		tabulated_ = true;
+
+		// Report
+		out << std::endl;
+		out << " * Tabulated thermodynamic properties of species (" << Tmin << " K - " << Tmax << " K, ";
+		out << ( (interpolation == TemperatureTable::TEMPERATURE_TABLE_LINEAR) ? "linear" : "cubic" ) << " interpolation)" << std::endl;
+		out << "   Property                   Props     Nodes    dT[K]    Mem[MB]     Max.Error      T[K]   Index" << std::endl;
+		table_cp_->Summary(out);
+		table_h_->Summary(out);
+		table_s_->Summary(out);
+
+		if (table_cp_->MaxRelativeError() > max_error || table_h_->MaxRelativeError() > max_error || table_s_->MaxRelativeError() > max_error)
+			out << "   Warning: the requested accuracy (" << max_error << ") was not reached for all the properties" << std::endl;
+		out << std::endl;
+
+		// Restore the original conditions
+		SetTemperature(T_backup);
+	}
 }
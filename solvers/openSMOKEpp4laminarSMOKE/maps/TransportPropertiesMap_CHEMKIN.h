@@ -39,6 +39,8 @@
 
 #include "TransportPropertiesMap.h"
 #include "rapidxml.hpp"
+#include "TemperatureTable.h"
+#include <boost/shared_ptr.hpp>
 
 namespace OpenSMOKE
 {
@@ -66,6 +68,13 @@ namespace OpenSMOKE
 		*/
 		TransportPropertiesMap_CHEMKIN(rapidxml::xml_document<>& doc);
 
+		/**
+		*@brief Creates a transport map reading the fitting coefficients from the binary image of the mechanism
+		*@param doc file in XML format (only the names of species and the viscosity model are read)
+		*@param fImage binary image of the mechanism, already positioned after the thermodynamic data
+		*/
+		TransportPropertiesMap_CHEMKIN(rapidxml::xml_document<>& doc, std::ifstream& fImage);
+
 		/**
 		*@brief Copy constructor
 		*@param rhs the object to be copied in the current object
@@ -105,6 +114,18 @@ namespace OpenSMOKE
 		*/
 		virtual void ImportLennardJonesCoefficientsFromASCIIFile(std::istream& fInput);
 
+		/**
+		*@brief Import the fitting and Lennard-Jones coefficients from the binary image of the mechanism
+		*@param fImage binary image of the mechanism
+		*/
+		void ImportCoefficientsFromBinaryImage(std::ifstream& fImage);
+
+		/**
+		*@brief Writes the fitting and Lennard-Jones coefficients on the binary image of the mechanism
+		*@param fImage binary image of the mechanism
+		*/
+		void WriteCoefficientsOnBinaryImage(std::ofstream& fImage);
+
 		/**
 		*@brief Import the coefficients from a file in XML format
 		*/
@@ -230,6 +251,44 @@ namespace OpenSMOKE
 		*/
 		double kCollision(const unsigned int i, const unsigned int k, const double T);
 
+		/**
+		*@brief Calculates the mixture transport properties of a set of cells, which are processed in blocks
+		         of BLOCK_SIZE cells: the species properties are evaluated for all the cells of the block at 
+		         once and the mixing rules are applied along the cells (contiguous memory, vectorizable loops)
+		*@param n number of cells
+		*@param T temperatures [K]
+		*@param P pressures [Pa]
+		*@param x mole fractions (x[i][c] is the mole fraction of species i in cell c, 0-index based)
+		*@param etamix mixture dynamic viscosities [kg/m/s] (NULL if not needed)
+		*@param lambdamix mixture thermal conductivities [W/m/K] (NULL if not needed)
+		*@param gammamix mixture-averaged mass diffusion coefficients [m2/s] (gammamix[i][c], NULL if not needed)
+		*/
+		void TransportPropertiesBlock(	const unsigned int n, const double* T, const double* P, const double* const* x,
+						double* etamix, double* lambdamix, double* const* gammamix);
+
+		static const unsigned int BLOCK_SIZE;	//!< number of cells processed together by TransportPropertiesBlock
+
+		/**
+		*@brief Replaces the fitting correlations of species properties (thermal conductivities, dynamic viscosities
+		         and binary diffusion coefficients) with the interpolation on a uniform temperature grid. 
+		         For each property the step is halved until the maximum relative error, checked at the 
+		         midpoints of the grid intervals, is below the requested tolerance. Outside the range 
+		         [Tmin,Tmax] the fitting correlations are used. The tables are shared by copies of the map.
+		*@param Tmin minimum temperature [K]
+		*@param Tmax maximum temperature [K]
+		*@param dT initial temperature step [K]
+		*@param interpolation interpolation type (linear or cubic)
+		*@param max_error maximum relative error
+		*@param out stream on which the verification report is written
+		*/
+		void Tabulate(	const double Tmin, const double Tmax, const double dT, 
+				const TemperatureTable::Interpolation interpolation, const double max_error, std::ostream& out);
+
+		/**
+		*@brief Returns true if the species properties are interpolated from tables
+		*/
+		bool is_tabulated() const { return tabulated_; }
+
 	private:
 
 		/**
@@ -310,6 +369,29 @@ namespace OpenSMOKE
 		std::vector<double> sigma_;					//!< species collision diameters (in m)
 		std::vector<double> epsilon_over_kb_;		//!< species scaled well depths (in K)
 
+		// Auxiliary vectors for the evaluation of the properties of blocks of cells
+		std::vector<double> block_logT_;	//!< logarithm of temperature (and its powers)
+		std::vector<double> block_mix_;		//!< auxiliary vectors (one value per cell)
+		std::vector<double> block_species_;	//!< auxiliary vectors (one value per species and per cell)
+		std::vector<double> block_table_;	//!< properties of species interpolated from the tables (one cell)
+
+		/**
+		*@brief Exponential of a vector, written to be vectorized by the compiler (used when MKL is not available)
+		*/
+		static void BlockExp(const unsigned int n, const double* x, double* y);
+
+		// Tabulation of species properties
+		bool tabulated_ = false;					//!< true if the species properties are interpolated from tables
+		boost::shared_ptr<TemperatureTable> table_lambda_;	//!< tabulated thermal conductivities
+		boost::shared_ptr<TemperatureTable> table_eta_;		//!< tabulated dynamic viscosities
+		boost::shared_ptr<TemperatureTable> table_gamma_;	//!< tabulated reciprocal binary diffusion coefficients (at 1 bar)
+
+		/**
+		*@brief Creates and verifies the table of a species property (0: lambda, 1: eta, 2: gamma)
+		*/
+		boost::shared_ptr<TemperatureTable> TabulateProperty(	const unsigned int property, const double Tmin, const double Tmax, const double dT, 
+									const TemperatureTable::Interpolation interpolation, const double max_error);
+
 	};
 }
 
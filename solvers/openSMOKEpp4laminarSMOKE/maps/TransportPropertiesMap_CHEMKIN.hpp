@@ -37,6 +37,8 @@
 #include "math/OpenSMOKEUtilities.h"
 #include "TransportPropertiesMap_CHEMKIN.h"
 #include "preprocessing/CollisionIntegralMatrices.hpp"
+#include <cstring>
+#include <stdint.h>
 
 #if OPENSMOKE_USE_MKL == 1
 #include "mkl.h"
@@ -82,6 +84,24 @@ namespace OpenSMOKE
 		ImportCoefficientsFromXMLFile(doc);
 	}
 
+	TransportPropertiesMap_CHEMKIN::TransportPropertiesMap_CHEMKIN(rapidxml::xml_document<>& doc, std::ifstream& fImage)
+	{
+		temperature_lambda_must_be_recalculated_ = true;
+		temperature_eta_must_be_recalculated_ = true;
+		temperature_gamma_must_be_recalculated_ = true;
+		temperature_teta_must_be_recalculated_ = true;
+		pressure_gamma_must_be_recalculated_ = true;
+		this->T_ = this->P_ = 0.;
+		this->T_old_ = this->P_old_ = 0.;
+
+		this->species_bundling_ = false;
+
+		ImportSpeciesFromXMLFile(doc);
+		ImportViscosityModelFromXMLFile(doc);
+		MemoryAllocation();
+		ImportCoefficientsFromBinaryImage(fImage);
+	}
+
 	TransportPropertiesMap_CHEMKIN::TransportPropertiesMap_CHEMKIN(const TransportPropertiesMap_CHEMKIN& rhs)
 	{
 		CopyFromMap(rhs);
@@ -212,6 +232,8 @@ namespace OpenSMOKE
 			this->bundling_reference_species_ = rhs.bundling_reference_species_;
 			this->bundling_groups_ = rhs.bundling_groups_;
 			this->bundling_species_group_ = rhs.bundling_species_group_;
+			this->bundling_sum_diffusion_coefficients_.resize(this->bundling_number_groups_);
+			this->bundling_sum_x_groups_.resize(this->bundling_number_groups_);
 
 			this->bundling_fittingGammaSelfDiffusion_ = new double[4 * this->nspecies_];
 			this->bundling_fittingGamma_ = new double[this->bundling_number_groups_*(this->bundling_number_groups_ - 1) / 2 * 4];
@@ -233,6 +255,11 @@ namespace OpenSMOKE
 
 		this->tetaSpecies_.resize(this->nspecies_*iThermalDiffusionRatios_.size());
 		this->tetaSpecies_.setZero();
+
+		this->tabulated_ = rhs.tabulated_;
+		this->table_lambda_ = rhs.table_lambda_;
+		this->table_eta_ = rhs.table_eta_;
+		this->table_gamma_ = rhs.table_gamma_;
 	}
 
 	void TransportPropertiesMap_CHEMKIN::MemoryAllocation()
@@ -417,6 +444,76 @@ namespace OpenSMOKE
 		}
 	}
 
+	void TransportPropertiesMap_CHEMKIN::ImportCoefficientsFromBinaryImage(std::ifstream& fImage)
+	{
+		std::cout << " * Reading transport properties from binary image..." << std::endl;
+
+		unsigned int nspecies = 0;
+		Load(fImage, OPENSMOKE_BINARY_FILE, nspecies);
+		if (nspecies != this->nspecies_)
+			ErrorMessage("TransportPropertiesMap_CHEMKIN::ImportCoefficientsFromBinaryImage", "The binary image does not match the number of species.");
+
+		// Fitting coefficients
+		unsigned int n_thermal_diffusion_ratios = 0;
+		Load(fImage, OPENSMOKE_BINARY_FILE, count_species_thermal_diffusion_ratios_);
+		Load(fImage, OPENSMOKE_BINARY_FILE, n_thermal_diffusion_ratios);
+		iThermalDiffusionRatios_.resize(n_thermal_diffusion_ratios);
+		fittingTeta = new double[4 * count_species_thermal_diffusion_ratios_*this->nspecies_];
+
+		Load(fImage, OPENSMOKE_BINARY_FILE, n_thermal_diffusion_ratios, iThermalDiffusionRatios_.data());
+		Load(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, M);
+		Load(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_ * 4, fittingLambda);
+		Load(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_ * 4, fittingEta);
+		Load(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_*(this->nspecies_ - 1) / 2 * 4, fittingGamma);
+		Load(fImage, OPENSMOKE_BINARY_FILE, count_species_thermal_diffusion_ratios_*this->nspecies_ * 4, fittingTeta);
+
+		// Lennard-Jones parameters
+		Load(fImage, OPENSMOKE_BINARY_FILE, is_lennard_jones_available_);
+		if (is_lennard_jones_available_ == true)
+		{
+			mu_.resize(this->nspecies_);
+			sigma_.resize(this->nspecies_);
+			epsilon_over_kb_.resize(this->nspecies_);
+
+			Load(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, mu_.data());
+			Load(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, sigma_.data());
+			Load(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, epsilon_over_kb_.data());
+		}
+
+		if (!fImage)
+			ErrorMessage("TransportPropertiesMap_CHEMKIN::ImportCoefficientsFromBinaryImage", "The binary image cannot be read.");
+
+		// Complete the initialization
+		CompleteInitialization();
+	}
+
+	void TransportPropertiesMap_CHEMKIN::WriteCoefficientsOnBinaryImage(std::ofstream& fImage)
+	{
+		unsigned int nspecies = this->nspecies_;
+		Save(fImage, OPENSMOKE_BINARY_FILE, nspecies);
+
+		// Fitting coefficients
+		unsigned int n_thermal_diffusion_ratios = static_cast<unsigned int>(iThermalDiffusionRatios_.size());
+		Save(fImage, OPENSMOKE_BINARY_FILE, count_species_thermal_diffusion_ratios_);
+		Save(fImage, OPENSMOKE_BINARY_FILE, n_thermal_diffusion_ratios);
+
+		Save(fImage, OPENSMOKE_BINARY_FILE, n_thermal_diffusion_ratios, iThermalDiffusionRatios_.data());
+		Save(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, M);
+		Save(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_ * 4, fittingLambda);
+		Save(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_ * 4, fittingEta);
+		Save(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_*(this->nspecies_ - 1) / 2 * 4, fittingGamma);
+		Save(fImage, OPENSMOKE_BINARY_FILE, count_species_thermal_diffusion_ratios_*this->nspecies_ * 4, fittingTeta);
+
+		// Lennard-Jones parameters
+		Save(fImage, OPENSMOKE_BINARY_FILE, is_lennard_jones_available_);
+		if (is_lennard_jones_available_ == true)
+		{
+			Save(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, mu_.data());
+			Save(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, sigma_.data());
+			Save(fImage, OPENSMOKE_BINARY_FILE, this->nspecies_, epsilon_over_kb_.data());
+		}
+	}
+
 	void TransportPropertiesMap_CHEMKIN::ImportCoefficientsFromXMLFile(rapidxml::xml_document<>& doc)
 	{
 		std::cout << " * Reading transport properties from XML file..." << std::endl;
@@ -691,6 +788,13 @@ namespace OpenSMOKE
 	{
         if (temperature_lambda_must_be_recalculated_ == true)
         {
+			if (tabulated_ == true && table_lambda_->InRange(T_) == true)
+			{
+				table_lambda_->Interpolate(T_, this->lambdaSpecies_.data());
+				temperature_lambda_must_be_recalculated_ = false;
+				return;
+			}
+
 			const double logT=std::log(T_);
 			const double logT2=logT*logT;
 			const double logT3=logT*logT2;
@@ -730,6 +834,13 @@ namespace OpenSMOKE
 	{
         if (temperature_eta_must_be_recalculated_ == true)
         {
+			if (tabulated_ == true && table_eta_->InRange(T_) == true)
+			{
+				table_eta_->Interpolate(T_, this->etaSpecies_.data());
+				temperature_eta_must_be_recalculated_ = false;
+				return;
+			}
+
 			const double logT=std::log(T_);
 			const double logT2=logT*logT;
 			const double logT3=logT*logT2;
@@ -812,6 +923,19 @@ namespace OpenSMOKE
             
         if ( temperature_gamma_must_be_recalculated_ == true || pressure_gamma_must_be_recalculated_ == true )
         {
+			if (tabulated_ == true && table_gamma_->InRange(T_) == true)
+			{
+				// The tables store the reciprocal binary diffusion coefficients at 1 bar
+				const double P_bar = P_/100000.;
+				table_gamma_->Interpolate(T_, this->gammaSpecies_.data());
+				for (unsigned int i=0;i<this->nspecies_*(this->nspecies_-1)/2;i++)
+					this->gammaSpecies_(i) *= P_bar;
+
+				temperature_gamma_must_be_recalculated_ = false;
+				pressure_gamma_must_be_recalculated_ = false;
+				return;
+			}
+
 			// Only the upper hals of this matrix is evaluated (the main diagonalis not evaluated)
 			// Indeed the matrix is symmetric and the mixture rule is able to exploit this kind of symmetry
 
@@ -1390,4 +1514,485 @@ namespace OpenSMOKE
 
 		fBenchmark.close();
 	}
+
+	const unsigned int TransportPropertiesMap_CHEMKIN::BLOCK_SIZE = 64;
+
+	void TransportPropertiesMap_CHEMKIN::BlockExp(const unsigned int n, const double* x, double* y)
+	{
+		// Cody-Waite range reduction: exp(x) = 2^k exp(r), with |r| <= ln2/2
+		// The loop has no branches and no calls, so it can be vectorized by the compiler
+		// The arguments are logarithms of transport properties, which are far from the
+		// overflow/underflow limits of double precision: no range check is performed
+		const double log2e = 1.4426950408889634074;
+		const double ln2_hi = 6.93145751953125e-1;
+		const double ln2_lo = 1.42860682030941723212e-6;
+		const double shifter = 6755399441055744.;	// 1.5*2^52
+
+		int64_t shifter_bits;
+		std::memcpy(&shifter_bits, &shifter, sizeof(double));
+
+		for (unsigned int i=0;i<n;i++)
+		{
+			const double t = x[i]*log2e + shifter;
+			const double k = t - shifter;
+			const double r = (x[i] - k*ln2_hi) - k*ln2_lo;
+
+			// Taylor polynomial up to r^12/12!
+			double p = 2.08767569878680989792e-9;
+			p = p*r + 2.50521083854417187751e-8;
+			p = p*r + 2.75573192239858906526e-7;
+			p = p*r + 2.75573192239858906526e-6;
+			p = p*r + 2.48015873015873015873e-5;
+			p = p*r + 1.98412698412698412698e-4;
+			p = p*r + 1.38888888888888888889e-3;
+			p = p*r + 8.33333333333333333333e-3;
+			p = p*r + 4.16666666666666666667e-2;
+			p = p*r + 1.66666666666666666667e-1;
+			p = p*r + 0.5;
+			p = p*r + 1.;
+			p = p*r + 1.;
+
+			// 2^k is built directly from the exponent bits
+			int64_t bits;
+			std::memcpy(&bits, &t, sizeof(double));
+			bits = (bits - shifter_bits + 1023) << 52;
+			double scale;
+			std::memcpy(&scale, &bits, sizeof(double));
+
+			y[i] = p*scale;
+		}
+	}
+
+	void TransportPropertiesMap_CHEMKIN::TransportPropertiesBlock(	const unsigned int n, const double* T, const double* P, const double* const* x,
+									double* etamix, double* lambdamix, double* const* gammamix)
+	{
+		const unsigned int ns = this->nspecies_;
+
+		// Memory allocation (only the first time)
+		if (block_logT_.size() == 0)
+		{
+			block_logT_.resize(3*BLOCK_SIZE);
+			block_mix_.resize(3*BLOCK_SIZE);
+			block_species_.resize(4*ns*BLOCK_SIZE);
+		}
+
+		// Properties of species interpolated from the tables (only the first time)
+		if (tabulated_ == true && block_table_.size() == 0)
+			block_table_.resize(std::max(ns, ns*(ns-1)/2));
+
+		for (unsigned int offset=0;offset<n;offset+=BLOCK_SIZE)
+		{
+			const unsigned int m = std::min(BLOCK_SIZE, n-offset);
+
+			double* logT  = &block_logT_[0];
+			double* logT2 = &block_logT_[BLOCK_SIZE];
+			double* logT3 = &block_logT_[2*BLOCK_SIZE];
+			for (unsigned int c=0;c<m;c++)
+			{
+				logT[c]  = std::log(T[offset+c]);
+				logT2[c] = logT[c]*logT[c];
+				logT3[c] = logT[c]*logT2[c];
+			}
+
+			// The tables are used only if all the temperatures of the block are in range 
+			// (otherwise the properties of species are evaluated through the fitting coefficients)
+			bool etaFromTable = tabulated_;
+			bool lambdaFromTable = tabulated_;
+			bool gammaFromTable = tabulated_;
+			for (unsigned int c=0;c<m;c++)
+			{
+				if (etaFromTable == true && table_eta_->InRange(T[offset+c]) == false)	etaFromTable = false;
+				if (lambdaFromTable == true && table_lambda_->InRange(T[offset+c]) == false)	lambdaFromTable = false;
+				if (gammaFromTable == true && table_gamma_->InRange(T[offset+c]) == false)	gammaFromTable = false;
+			}
+
+			// Species properties are stored species by species (m values per species)
+			double* propertySpecies = &block_species_[0];
+			double* auxSpecies1 = &block_species_[ns*BLOCK_SIZE];
+			double* auxSpecies2 = &block_species_[2*ns*BLOCK_SIZE];
+			double* auxSpecies3 = &block_species_[3*ns*BLOCK_SIZE];
+			double* auxMix1 = &block_mix_[0];
+			double* auxMix2 = &block_mix_[BLOCK_SIZE];
+			double* auxMix3 = &block_mix_[2*BLOCK_SIZE];
+
+			// Dynamic viscosity
+			if (etamix != NULL)
+			{
+				if (etaFromTable == true)
+				{
+					for (unsigned int c=0;c<m;c++)
+					{
+						table_eta_->Interpolate(T[offset+c], block_table_.data());
+						for (unsigned int j=0;j<ns;j++)
+							propertySpecies[j*m+c] = block_table_[j];
+					}
+				}
+				else
+				{
+					const double* k = fittingEta;
+					for (unsigned int j=0;j<ns;j++)
+					{
+						double* eta = &propertySpecies[j*m];
+						for (unsigned int c=0;c<m;c++)
+							eta[c] = k[0] + k[1]*logT[c] + k[2]*logT2[c] + k[3]*logT3[c];
+						k += 4;
+					}
+
+					#if OPENSMOKE_USE_MKL == 1
+						vdExp(ns*m, propertySpecies, propertySpecies);
+					#else
+						BlockExp(ns*m, propertySpecies, propertySpecies);
+					#endif
+				}
+
+				if(viscosity_model == PhysicalConstants::OPENSMOKE_GASMIXTURE_VISCOSITYMODEL_WILKE)
+				{
+					double* sqrtEtaBlock = auxSpecies1;
+					double* usqrtEtaBlock = auxSpecies2;
+					double* sumKBlock = auxSpecies3;
+
+					#if OPENSMOKE_USE_MKL == 1
+						vdSqrt(ns*m, propertySpecies, sqrtEtaBlock);
+						vdInv(ns*m, sqrtEtaBlock, usqrtEtaBlock);
+					#else
+						for (unsigned int i=0;i<ns*m;i++)
+						{
+							sqrtEtaBlock[i] = std::sqrt(propertySpecies[i]);
+							usqrtEtaBlock[i] = 1./sqrtEtaBlock[i];
+						}
+					#endif
+
+					for (unsigned int k=0;k<ns;k++)
+					{
+						const double* xk = x[k]+offset;
+						double* sumK = &sumKBlock[k*m];
+						for (unsigned int c=0;c<m;c++)
+							sumK[c] = xk[c];
+					}
+
+					// Wilke - Journal of Chemical Physics 18:517 (1950)
+					// The inverse of delta_phi is evaluated without divisions (the ratio of molecular weights is the same for all the cells)
+					const double* ptMWRatio1over4=MWRatio1over4;
+					const double* ptphi_eta_sup=phi_eta_sup;
+					const double* ptphi_eta_inf=phi_eta_inf;
+					for (unsigned int k=0;k<ns;k++)
+					{
+						const double* xk = x[k]+offset;
+						const double* sqrtEtak = &sqrtEtaBlock[k*m];
+						const double* usqrtEtak = &usqrtEtaBlock[k*m];
+						double* sumKk = &sumKBlock[k*m];
+
+						for (unsigned int j=k+1;j<ns;j++)
+						{
+							const double* xj = x[j]+offset;
+							const double* sqrtEtaj = &sqrtEtaBlock[j*m];
+							const double* usqrtEtaj = &usqrtEtaBlock[j*m];
+							double* sumKj = &sumKBlock[j*m];
+
+							const double ratio = *ptMWRatio1over4++;
+							const double uratio = 1./ratio;
+							const double sup = *ptphi_eta_sup++;
+							const double inf = *ptphi_eta_inf++;
+
+							for (unsigned int c=0;c<m;c++)
+							{
+								const double delta_phi = 1. + sqrtEtak[c]*usqrtEtaj[c]*ratio;		// F.(49)
+								const double udelta_phi = 1. + sqrtEtaj[c]*usqrtEtak[c]*uratio;
+								sumKk[c] += xj[c]*sup*delta_phi*delta_phi;
+								sumKj[c] += xk[c]*inf*udelta_phi*udelta_phi;
+							}
+						}
+					}
+
+					for (unsigned int c=0;c<m;c++)
+						etamix[offset+c] = 0.;
+					for (unsigned int k=0;k<ns;k++)
+					{
+						const double* xk = x[k]+offset;
+						const double* eta = &propertySpecies[k*m];
+						const double* sumK = &sumKBlock[k*m];
+						for (unsigned int c=0;c<m;c++)
+							etamix[offset+c] += xk[c]*eta[c]/sumK[c];				// F.(48)
+					}
+				}
+				else if (viscosity_model == PhysicalConstants::OPENSMOKE_GASMIXTURE_VISCOSITYMODEL_HERNING)
+				{
+					for (unsigned int c=0;c<m;c++)
+					{
+						auxMix1[c] = 0.;
+						etamix[offset+c] = 0.;
+					}
+					for (unsigned int k=0;k<ns;k++)
+					{
+						const double* xk = x[k]+offset;
+						const double* eta = &propertySpecies[k*m];
+						for (unsigned int c=0;c<m;c++)
+						{
+							auxMix1[c] += xk[c]*sqrtMW[k];
+							etamix[offset+c] += xk[c]*eta[c]*sqrtMW[k];
+						}
+					}
+					for (unsigned int c=0;c<m;c++)
+						etamix[offset+c] /= auxMix1[c];
+				}
+				else if (viscosity_model == PhysicalConstants::OPENSMOKE_GASMIXTURE_VISCOSITYMODEL_MATHUR_SAXENA)
+				{
+					for (unsigned int c=0;c<m;c++)
+					{
+						auxMix1[c] = 0.;
+						auxMix2[c] = 0.;
+					}
+					for (unsigned int k=0;k<ns;k++)
+					{
+						const double* xk = x[k]+offset;
+						const double* eta = &propertySpecies[k*m];
+						for (unsigned int c=0;c<m;c++)
+						{
+							auxMix1[c] += xk[c]*eta[c];
+							auxMix2[c] += xk[c]/eta[c];
+						}
+					}
+					for (unsigned int c=0;c<m;c++)
+						etamix[offset+c] = 0.50*(auxMix1[c] + 1./auxMix2[c]);
+				}
+			}
+
+			// Thermal conductivity
+			// Formula di Mathur, Todor, Saxena - Molecular Physics 52:569 (1967)
+			if (lambdamix != NULL)
+			{
+				if (lambdaFromTable == true)
+				{
+					for (unsigned int c=0;c<m;c++)
+					{
+						table_lambda_->Interpolate(T[offset+c], block_table_.data());
+						for (unsigned int j=0;j<ns;j++)
+							propertySpecies[j*m+c] = block_table_[j];
+					}
+				}
+				else
+				{
+					const double* k = fittingLambda;
+					for (unsigned int j=0;j<ns;j++)
+					{
+						double* lambda = &propertySpecies[j*m];
+						for (unsigned int c=0;c<m;c++)
+							lambda[c] = k[0] + k[1]*logT[c] + k[2]*logT2[c] + k[3]*logT3[c];
+						k += 4;
+					}
+
+					#if OPENSMOKE_USE_MKL == 1
+						vdExp(ns*m, propertySpecies, propertySpecies);
+					#else
+						BlockExp(ns*m, propertySpecies, propertySpecies);
+					#endif
+				}
+
+				for (unsigned int c=0;c<m;c++)
+				{
+					auxMix1[c] = 0.;
+					auxMix2[c] = 0.;
+				}
+				for (unsigned int k=0;k<ns;k++)
+				{
+					const double* xk = x[k]+offset;
+					const double* lambda = &propertySpecies[k*m];
+					for (unsigned int c=0;c<m;c++)
+					{
+						auxMix1[c] += xk[c]*lambda[c];
+						auxMix2[c] += xk[c]/lambda[c];
+					}
+				}
+				for (unsigned int c=0;c<m;c++)
+					lambdamix[offset+c] = 0.50*(auxMix1[c] + 1./auxMix2[c]);
+			}
+
+			// Mass diffusion coefficients (mixture averaged)
+			// The binary diffusion coefficients are not stored, but directly accumulated
+			if (gammamix != NULL)
+			{
+				double* xc = auxSpecies1;
+				double* sumD = auxSpecies2;
+				double* MWmix = auxMix1;
+				double* Dkj = auxMix2;
+				double* lnP_bar = auxMix3;
+
+				for (unsigned int c=0;c<m;c++)
+				{
+					MWmix[c] = 0.;
+					lnP_bar[c] = std::log(P[offset+c]/100000.);
+				}
+
+				// Adjust mole fractions
+				for (unsigned int k=0;k<ns;k++)
+				{
+					const double* xk = x[k]+offset;
+					double* xck = &xc[k*m];
+					double* sumDk = &sumD[k*m];
+					for (unsigned int c=0;c<m;c++)
+					{
+						xck[c] = (xk[c]+threshold_)/sum_threshold_;
+						MWmix[c] += xck[c]*M[k];
+						sumDk[c] = 0.;
+					}
+				}
+
+				if (gammaFromTable == true)
+				{
+					// The tables store the reciprocal binary diffusion coefficients at 1 bar (upper half of the matrix)
+					for (unsigned int c=0;c<m;c++)
+					{
+						const double P_bar = P[offset+c]/100000.;
+						table_gamma_->Interpolate(T[offset+c], block_table_.data());
+
+						const double* gamma = block_table_.data();
+						for (unsigned int k=0;k<ns;k++)
+							for (unsigned int j=k+1;j<ns;j++)
+							{
+								const double gammakj = P_bar*(*gamma++);
+								sumD[j*m+c] += xc[k*m+c]*gammakj;
+								sumD[k*m+c] += xc[j*m+c]*gammakj;
+							}
+					}
+				}
+				else
+				{
+					const double* d = fittingGamma;
+					for (unsigned int k=0;k<ns;k++)
+					{
+						const double* xck = &xc[k*m];
+						double* sumDk = &sumD[k*m];
+
+						for (unsigned int j=k+1;j<ns;j++)
+						{
+							const double* xcj = &xc[j*m];
+							double* sumDj = &sumD[j*m];
+
+							for (unsigned int c=0;c<m;c++)
+								Dkj[c] = lnP_bar[c] - (d[0] + d[1]*logT[c] + d[2]*logT2[c] + d[3]*logT3[c]);
+							d += 4;
+
+							#if OPENSMOKE_USE_MKL == 1
+								vdExp(m, Dkj, Dkj);
+							#else
+								BlockExp(m, Dkj, Dkj);
+							#endif
+
+							for (unsigned int c=0;c<m;c++)
+							{
+								sumDj[c] += xck[c]*Dkj[c];
+								sumDk[c] += xcj[c]*Dkj[c];
+							}
+						}
+					}
+				}
+
+				for (unsigned int k=0;k<ns;k++)
+				{
+					const double* xck = &xc[k*m];
+					const double* sumDk = &sumD[k*m];
+					double* gammamixk = gammamix[k]+offset;
+					for (unsigned int c=0;c<m;c++)
+						gammamixk[c] = (MWmix[c] - xck[c]*M[k]) / (MWmix[c]*sumDk[c]);
+				}
+			}
+		}
+	}
+
+	boost::shared_ptr<TemperatureTable> TransportPropertiesMap_CHEMKIN::TabulateProperty(	const unsigned int property, const double Tmin, const double Tmax, const double dT, 
+												const TemperatureTable::Interpolation interpolation, const double max_error)
+	{
+		const unsigned int max_refinements = 4;
+
+		std::string name;
+		unsigned int n = this->nspecies_;
+		if (property == 0)	name = "thermal conductivity";
+		else if (property == 1)	name = "dynamic viscosity";
+		else			{ name = "binary diffusivity"; n = this->nspecies_*(this->nspecies_-1)/2; }
+
+		// The exact values are calculated through the fitting correlations
+		const bool tabulated_backup = tabulated_;
+		tabulated_ = false;
+		SetPressure(100000.);
+
+		const Eigen::VectorXd& species_property = (property == 0) ? this->lambdaSpecies_ : ( (property == 1) ? this->etaSpecies_ : this->gammaSpecies_ );
+
+		boost::shared_ptr<TemperatureTable> table;
+		double step = dT;
+		for (unsigned int k=0;k<=max_refinements;k++)
+		{
+			table.reset(new TemperatureTable(name, n, Tmin, Tmax, step, interpolation));
+
+			for (unsigned int j=0;j<table->NumberOfNodes();j++)
+			{
+				SetTemperature(table->Temperature(j));
+				temperature_lambda_must_be_recalculated_ = true;
+				temperature_eta_must_be_recalculated_ = true;
+				temperature_gamma_must_be_recalculated_ = true;
+				if (property == 0)	lambda();
+				else if (property == 1)	eta();
+				else			gamma();
+
+				for (unsigned int i=0;i<n;i++)
+					table->Node(j)[i] = species_property(i);
+			}
+
+			// Verification at the midpoints of the grid intervals (i.e. where the error is maximum)
+			for (unsigned int j=1;j<table->NumberOfNodes()-3;j++)
+			{
+				SetTemperature(table->Temperature(j)+0.50*step);
+				temperature_lambda_must_be_recalculated_ = true;
+				temperature_eta_must_be_recalculated_ = true;
+				temperature_gamma_must_be_recalculated_ = true;
+				if (property == 0)	lambda();
+				else if (property == 1)	eta();
+				else			gamma();
+
+				table->Verify(T_, species_property.data(), 1.e-300);
+			}
+
+			if (table->MaxRelativeError() <= max_error)
+				break;
+
+			step *= 0.50;
+		}
+
+		tabulated_ = tabulated_backup;
+
+		return table;
+	}
+
+	void TransportPropertiesMap_CHEMKIN::Tabulate(	const double Tmin, const double Tmax, const double dT, 
+							const TemperatureTable::Interpolation interpolation, const double max_error, std::ostream& out)
+	{
+		const double T_backup = this->T_;
+		const double P_backup = this->P_;
+
+		table_lambda_ = TabulateProperty(0, Tmin, Tmax, dT, interpolation, max_error);
+		table_eta_ = TabulateProperty(1, Tmin, Tmax, dT, interpolation, max_error);
+		table_gamma_ = TabulateProperty(2, Tmin, Tmax, dT, interpolation, max_error);
+		tabulated_ = true;
+
+		// Report
+		out << std::endl;
+		out << " * Tabulated transport properties of species (" << Tmin << " K - " << Tmax << " K, ";
+		out << ( (interpolation == TemperatureTable::TEMPERATURE_TABLE_LINEAR) ? "linear" : "cubic" ) << " interpolation)" << std::endl;
+		out << "   Property                   Props     Nodes    dT[K]    Mem[MB]     Max.Error      T[K]   Index" << std::endl;
+		table_lambda_->Summary(out);
+		table_eta_->Summary(out);
+		table_gamma_->Summary(out);
+
+		if (table_lambda_->MaxRelativeError() > max_error || table_eta_->MaxRelativeError() > max_error || table_gamma_->MaxRelativeError() > max_error)
+			out << "   Warning: the requested accuracy (" << max_error << ") was not reached for all the properties" << std::endl;
+		out << std::endl;
+
+		// Restore the original conditions
+		SetTemperature(T_backup);
+		SetPressure(P_backup);
+		temperature_lambda_must_be_recalculated_ = true;
+		temperature_eta_must_be_recalculated_ = true;
+		temperature_gamma_must_be_recalculated_ = true;
+		temperature_teta_must_be_recalculated_ = true;
+		pressure_gamma_must_be_recalculated_ = true;
+	}
 }
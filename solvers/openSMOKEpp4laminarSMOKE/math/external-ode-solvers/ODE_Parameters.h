@@ -72,6 +72,8 @@ namespace OpenSMOKE
 		void SetMaximumNumberOfSteps(const int maximum_number_of_steps) { maximum_number_of_steps_ = maximum_number_of_steps; }
 		void SetMaximumOrder(const int maximum_order) { maximum_order_ = maximum_order; }
 		void SetFullPivoting(const bool flag) { full_pivoting_ = flag; }
+		void SetSparseSolver(const std::string sparse_solver) { sparse_solver_ = sparse_solver; }
+		void SetPreconditioner(const std::string preconditioner) { preconditioner_ = preconditioner; }
 		
 		void SetCPUTime(const double cpu_time) { cpu_time_ = cpu_time; }
 		void SetNumberOfFunctionCalls(const int number_of_function_calls) { number_of_function_calls_ = number_of_function_calls; }
@@ -438,7 +438,8 @@ namespace OdeSMOKE
 
 		if (solverType_ == OpenSMOKE::SOLVER_SPARSE_EIGEN_SPARSE_LU)
 		{
-			sparse_LU_.compute(G_);
+			// The sparsity pattern of G is fixed and was already analyzed during the memory allocation
+			sparse_LU_.factorize(G_);
 		}
 		else if (solverType_ == OpenSMOKE::SOLVER_SPARSE_EIGEN_BICGSTAB)
 		{
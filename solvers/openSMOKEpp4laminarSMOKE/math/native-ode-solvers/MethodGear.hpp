@@ -59,6 +59,8 @@ namespace OdeSMOKE
 	template <typename ODESystemKernel>
 	MethodGear<ODESystemKernel>::MethodGear()
 	{
+		// Memory is allocated only when the initial conditions are set
+		deltaAlfa1_ = 0.;
 	}
 
 	template <typename ODESystemKernel>
@@ -120,6 +122,13 @@ namespace OdeSMOKE
 		iterConvergence_ = 0;
 		iterConvergenceRate_ = 0;
 		iterConvergenceFailure_ = 0;
+		iterErrorFailure_ = 0;
+		stepOfLastJacobian_ = 0;
+		stepOfLastFactorization_ = 0;
+
+		// Safety coefficients (reduced during the integration)
+		for (unsigned int i = 0; i <= MAX_ORDER; i++)
+			alfa2_[i] = ALFA2;
 	}
 
 	template <typename ODESystemKernel>
@@ -128,6 +137,16 @@ namespace OdeSMOKE
 		// Kernel memory allocation
 		this->MemoryAllocationKernel();
 
+		// Release the memory allocated for a different number of equations
+		if (deltaAlfa1_ == DELTA_ALFA1)
+		{
+			delete[] r_;
+			delete[] Ep_;
+			delete[] z_;
+			delete[] v_;
+			delete[] alfa2_;
+		}
+
 		// Safety coefficient for choosing the optimal new order
 		deltaAlfa1_ = DELTA_ALFA1;
 		deltaAlfa3_ = DELTA_ALFA3;
@@ -165,6 +165,12 @@ namespace OdeSMOKE
 		*/
 		void SetFirstStepSize(const double initial_step_size);
 
+		/**
+		*@brief Set a lower bound for the automatic estimation of the first step (warm start from a previous integration)
+		*@param  warm_start_step_size the lower bound of the first step (0 to disable the warm start)
+		*/
+		void SetFirstStepSizeWarmStart(const double warm_start_step_size);
+
 		/**
 		*@brief Set the maximum order which can be used during the integration
 		*@param maximum_order the maximum order which can be used during the integration
@@ -198,6 +204,11 @@ namespace OdeSMOKE
 		*/
 		double firstStepSize() const { return first_step_size_; }
 
+		/**
+		*@brief Returns the size of the last step accepted during the integration
+		*/
+		double lastStepSize() const { return hPreviousStep_; }
+
 		/**
 		*@brief Returns the size of the minimum step used during the integration
 		*/
@@ -319,6 +330,7 @@ namespace OdeSMOKE
 
 		// Step size
 		double first_step_size_;	//!< size of the initial step
+		double first_step_size_warm_start_;	//!< lower bound for the automatic estimation of the initial step
 		double hPreviousStep_;		//!< size of the previous step
 		double hNordsieck_;			//!< size of Nordisieck step
 		double max_step_size_;		//!< maximum size of the step
@@ -79,6 +79,7 @@ namespace OdeSMOKE
 
 		// First step size
 		first_step_size_ = 0.;
+		first_step_size_warm_start_ = 0.;
 		user_defined_first_step_size_ = false;
 
 		// Minimum and maximum constraints
@@ -269,6 +270,15 @@ namespace OdeSMOKE
 		user_defined_first_step_size_ = true;
 	}
 
+	template <typename Method>
+	void MultiValueSolver<Method>::SetFirstStepSizeWarmStart(const double warm_start_step_size)
+	{
+		if (warm_start_step_size < 0)
+			FatalErrorMessage("The warm start step must be larger or equal to 0");
+
+		first_step_size_warm_start_ = warm_start_step_size;
+	}
+
 	template <typename Method>
 	void MultiValueSolver<Method>::SetStopConditionMaximumYPrimeNorm1(const double YPrimeNorm1)
 	{
@@ -457,7 +467,13 @@ namespace OdeSMOKE
 
 			// First step size
 			if (user_defined_first_step_size_ == false)
+			{
 				first_step_size_ = CalculateInitialStepSize();
+
+				// Warm start: the first step is not smaller than the suggested one
+				if (first_step_size_warm_start_ > std::fabs(first_step_size_))
+					first_step_size_ = first_step_size_warm_start_ * std::fabs(tOut_ - t0_) / (tOut_ - t0_);
+			}
 		
 			// Initialize calculations
 			this->z_[0] = y0_;
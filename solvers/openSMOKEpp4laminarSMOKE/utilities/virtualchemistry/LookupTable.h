@@ -36,6 +36,7 @@
 
 #include "Eigen/Dense"
 #include "math.h"
+#include <algorithm>
 
 #ifndef OpenSMOKEpp_LookupTable
 #define OpenSMOKEpp_LookupTable
@@ -55,10 +56,34 @@ namespace OpenSMOKE
 		void Interpolation(const double x);
 		double Interpolation(const double x, const unsigned int k);
 
+		/**
+		*@brief Interpolates the k-th variable for a vector of points
+		*@param n number of points
+		*@param x abscissas of the points
+		*@param k index of the variable (0-based)
+		*@param values interpolated values (n)
+		*/
+		void Interpolation(const unsigned int n, const double* x, const unsigned int k, double* values) const;
+
+		/**
+		*@brief Interpolates all the variables for a vector of points
+		*@param n number of points
+		*@param x abscissas of the points
+		*@param values interpolated values (n x nv)
+		*/
+		void Interpolation(const unsigned int n, const double* x, Eigen::MatrixXd& values) const;
+
 		inline const Eigen::VectorXd& interpolated() const { return interpolated_; }
 		unsigned int nv() const { return nv_; }
 		unsigned int np() const { return np_; }
 
+	private:
+
+		/**
+		*@brief Returns the index i of the interval [x(i-1), x(i)] including the point (min_x < x < max_x)
+		*/
+		inline unsigned int Interval(const double x) const;
+
 	private:
 
 		unsigned int nv_;
@@ -71,6 +96,10 @@ namespace OpenSMOKE
 		std::vector<bool> iRegressions_;
 		Eigen::VectorXd	interpolated_;
 
+		bool is_uniform_;		//!< true if the abscissas are equally spaced
+		double inverse_dx_;		//!< inverse of the (uniform) spacing
+		double last_x_;			//!< abscissa of the last interpolation stored in interpolated_
+
 	};
 }
 
@@ -86,6 +86,32 @@ namespace OpenSMOKE
 
 		std::cout << "Virtual chemistry: min(x)=" << min_x_ << " - max(x)=" << max_x_ << std::endl;
 
+		// Check the ordering and spacing of abscissas (uniform grids are indexed directly)
+		{
+			for (unsigned int i = 1; i < np_; i++)
+				if (x_(i) <= x_(i - 1))
+				{
+					std::cout << "Virtual Chemistry: error in reading the table. The abscissas must be strictly increasing" << std::endl;
+					abort();
+				}
+
+			const double dx = (max_x_ - min_x_) / double(np_ - 1);
+
+			is_uniform_ = true;
+			for (unsigned int i = 1; i < np_ - 1; i++)
+				if (std::fabs(x_(i) - (min_x_ + double(i)*dx)) > 1.e-9*dx)
+				{
+					is_uniform_ = false;
+					break;
+				}
+
+			inverse_dx_ = 1. / dx;
+			last_x_ = min_x_ - 1.;
+
+			if (is_uniform_ == true)
+				std::cout << "Virtual chemistry: uniform spacing (dx=" << dx << ")" << std::endl;
+		}
+
 		// Precalculation of ratios to be used in interpolation
 		for (unsigned int i = 1; i<np_; i++)
 			for (unsigned int k = 0; k<nv_; k++)
@@ -113,29 +139,41 @@ namespace OpenSMOKE
 		std::cout << std::endl;
 	}
 
+	inline unsigned int LookupTable::Interval(const double x) const
+	{
+		if (is_uniform_ == true)
+		{
+			const unsigned int i = static_cast<unsigned int>((x - min_x_)*inverse_dx_) + 1;
+			return (i < np_) ? i : np_ - 1;
+		}
+		else
+		{
+			return static_cast<unsigned int>(std::lower_bound(x_.data() + 1, x_.data() + np_, x) - x_.data());
+		}
+	}
+
 	void LookupTable::Interpolation(const double x)
 	{
+		if (x == last_x_)
+			return;
+
+		last_x_ = x;
+
 		if (x <= min_x_)
 		{
 			for (unsigned int k = 0; k < nv_; k++)
 				interpolated_(k) = v_(0, k);
-			return;
 		}
 		else if (x >= max_x_)
 		{
 			for (unsigned int k = 0; k < nv_; k++)
 				interpolated_(k) = v_(np_ - 1, k);
-			return;
 		}
 		else
 		{
-			for (unsigned int i = 1; i < np_; i++)
-				if (x_(i) >= x)
-				{
-					for (unsigned int k = 0; k < nv_; k++)
-						interpolated_(k) = v_(i - 1, k) + ratios_(i - 1, k)*(x - x_(i - 1));
-					return;
-				}
+			const unsigned int i = Interval(x);
+			for (unsigned int k = 0; k < nv_; k++)
+				interpolated_(k) = v_(i - 1, k) + ratios_(i - 1, k)*(x - x_(i - 1));
 		}
 	}
 
@@ -151,11 +189,50 @@ namespace OpenSMOKE
 		}
 		else
 		{
-			for (unsigned int i = 1; i < np_; i++)
-				if (x_(i) >= x)
-				{
-					return (v_(i - 1, k) + ratios_(i - 1, k)*(x - x_(i - 1)));
-				}
+			const unsigned int i = Interval(x);
+			return (v_(i - 1, k) + ratios_(i - 1, k)*(x - x_(i - 1)));
+		}
+	}
+
+	void LookupTable::Interpolation(const unsigned int n, const double* x, const unsigned int k, double* values) const
+	{
+		for (unsigned int j = 0; j < n; j++)
+		{
+			if (x[j] <= min_x_)
+			{
+				values[j] = v_(0, k);
+			}
+			else if (x[j] >= max_x_)
+			{
+				values[j] = v_(np_ - 1, k);
+			}
+			else
+			{
+				const unsigned int i = Interval(x[j]);
+				values[j] = v_(i - 1, k) + ratios_(i - 1, k)*(x[j] - x_(i - 1));
+			}
+		}
+	}
+
+	void LookupTable::Interpolation(const unsigned int n, const double* x, Eigen::MatrixXd& values) const
+	{
+		values.resize(n, nv_);
+
+		for (unsigned int j = 0; j < n; j++)
+		{
+			if (x[j] <= min_x_)
+			{
+				values.row(j) = v_.row(0);
+			}
+			else if (x[j] >= max_x_)
+			{
+				values.row(j) = v_.row(np_ - 1);
+			}
+			else
+			{
+				const unsigned int i = Interval(x[j]);
+				values.row(j) = v_.row(i - 1) + ratios_.row(i - 1)*(x[j] - x_(i - 1));
+			}
 		}
 	}
 }